@@ -0,0 +1,570 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Application interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_APPLICATION_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_APPLICATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/nvic.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+#include "picolibrary/arm/cortex/m0plus/priority_ceiling_lock.h"
+#include "picolibrary/arm/cortex/m0plus/vector_table_builder.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Task description.
+ *
+ * A task is an exception handler that runs at a fixed priority, and that accesses a fixed
+ * set of shared resources. Resources are identified by types (e.g. empty tag structures,
+ * or structures derived from picolibrary::Arm::Cortex::M0PLUS::Shared_Resource that own
+ * the resource's data).
+ *
+ * \tparam IRQ_NUMBER The IRQ number of the exception that runs the task (the SVCALL,
+ *         PENDSV, or SYSTICK0 exception, or an external interrupt).
+ * \tparam HANDLER The task's handler.
+ * \tparam PRIORITY The task's priority.
+ * \tparam Resources The resources the task accesses.
+ */
+template<Interrupt::IRQ_Number IRQ_NUMBER, Interrupt::Handler HANDLER, Interrupt_Priority PRIORITY, typename... Resources>
+struct Task {
+    /**
+     * \brief The IRQ number of the exception that runs the task.
+     */
+    static constexpr auto IRQ = IRQ_NUMBER;
+
+    /**
+     * \brief The task's handler.
+     */
+    static constexpr auto BOUND_HANDLER = HANDLER;
+
+    /**
+     * \brief The task's priority.
+     */
+    static constexpr auto TASK_PRIORITY = PRIORITY;
+
+    /**
+     * \brief Check if the task accesses a resource.
+     *
+     * \tparam Resource The resource to check.
+     *
+     * \return true if the task accesses the resource.
+     * \return false if the task does not access the resource.
+     */
+    template<typename Resource>
+    static constexpr auto uses() noexcept -> bool
+    {
+        return ( std::is_same_v<Resource, Resources> or ... );
+    }
+};
+
+template<typename... Tasks>
+class Application;
+
+/**
+ * \brief Shared resource that owns its data.
+ *
+ * A resource is identified by its own type, so each resource is a structure derived from
+ * this class template (e.g. struct Buffer : Shared_Resource<Ring_Buffer> {};). The
+ * resource's data can only be accessed through a
+ * picolibrary::Arm::Cortex::M0PLUS::Application::Lock that locks the resource, so
+ * accessing the resource's data without locking it does not compile.
+ *
+ * \tparam T The resource's data type.
+ */
+template<typename T>
+class Shared_Resource {
+  public:
+    /**
+     * \brief The resource's data type.
+     */
+    using Data = T;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Shared_Resource() noexcept : m_data{}
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Argument The type of the first argument used to construct the resource's
+     *         data.
+     * \tparam Arguments The types of the remaining arguments used to construct the
+     *         resource's data.
+     *
+     * \param[in] argument The first argument used to construct the resource's data.
+     * \param[in] arguments The remaining arguments used to construct the resource's data.
+     */
+    template<typename Argument, typename... Arguments>
+    constexpr explicit Shared_Resource( Argument && argument, Arguments &&... arguments ) noexcept :
+        m_data{ std::forward<Argument>( argument ), std::forward<Arguments>( arguments )... }
+    {
+    }
+
+    Shared_Resource( Shared_Resource && ) = delete;
+
+    Shared_Resource( Shared_Resource const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Shared_Resource() noexcept = default;
+
+    auto operator=( Shared_Resource && ) = delete;
+
+    auto operator=( Shared_Resource const & ) = delete;
+
+  private:
+    template<typename... Tasks>
+    friend class Application;
+
+    /**
+     * \brief The resource's data.
+     */
+    T m_data;
+};
+
+namespace Implementation {
+
+/**
+ * \brief Check if an exception is a system exception whose priority is configurable.
+ *
+ * \param[in] irq The exception's IRQ number.
+ *
+ * \return true if the exception is a system exception whose priority is configurable.
+ * \return false if the exception is not a system exception whose priority is
+ *         configurable.
+ */
+constexpr auto is_configurable_system_exception( Interrupt::IRQ_Number irq ) noexcept -> bool
+{
+    return irq == Interrupt::SVCALL_IRQ or irq == Interrupt::PENDSV_IRQ
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+           or irq == Interrupt::SYSTICK0_IRQ
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+        ;
+}
+
+/**
+ * \brief Compute the NVIC peripheral register values for the external interrupt tasks of
+ *        an application.
+ *
+ * \tparam Tasks The application's tasks.
+ *
+ * \return The NVIC peripheral register values for the external interrupt tasks.
+ */
+template<typename... Tasks>
+constexpr auto make_task_interrupt_controller_configuration() noexcept -> Interrupt_Controller_Configuration
+{
+    constexpr Interrupt::IRQ_Number irqs[]       = { Tasks::IRQ... };
+    constexpr Interrupt_Priority    priorities[] = { Tasks::TASK_PRIORITY... };
+
+    auto configuration = Interrupt_Controller_Configuration{};
+
+    for ( auto task = std::size_t{}; task < sizeof...( Tasks ); ++task ) {
+        if ( irqs[ task ] >= 0 ) {
+            auto const word  = static_cast<std::size_t>( irqs[ task ] ) / 4;
+            auto const shift = ( irqs[ task ] % 4 ) * 8;
+
+            configuration.ipr[ word ] |= std::uint32_t{ to_underlying( priorities[ task ] ) } << shift;
+            configuration.ipr_mask[ word ] |= std::uint32_t{ 0xFF } << shift;
+            configuration.iser |= std::uint32_t{ 1 } << irqs[ task ];
+        } // if
+    }     // for
+
+    return configuration;
+}
+
+/**
+ * \brief Get a system exception task's SHPR register priority field.
+ *
+ * \tparam Tasks The application's tasks.
+ *
+ * \param[in] irq The IRQ number of the system exception.
+ * \param[in] shift The priority field's position.
+ *
+ * \return The system exception task's SHPR register priority field.
+ * \return 0 if no task is run by the system exception.
+ */
+template<typename... Tasks>
+constexpr auto shpr_field( Interrupt::IRQ_Number irq, std::uint_fast8_t shift ) noexcept -> std::uint32_t
+{
+    auto field = std::uint32_t{};
+
+    static_cast<void>(
+        ( ( Tasks::IRQ == irq ? ( field = std::uint32_t{ to_underlying( Tasks::TASK_PRIORITY ) } << shift, true ) : false )
+          or ... ) );
+
+    return field;
+}
+
+/**
+ * \brief Get the mask identifying a system exception task's SHPR register priority
+ *        field.
+ *
+ * \tparam Tasks The application's tasks.
+ *
+ * \param[in] irq The IRQ number of the system exception.
+ * \param[in] shift The priority field's position.
+ *
+ * \return The mask identifying the system exception task's SHPR register priority field.
+ * \return 0 if no task is run by the system exception.
+ */
+template<typename... Tasks>
+constexpr auto shpr_field_mask( Interrupt::IRQ_Number irq, std::uint_fast8_t shift ) noexcept -> std::uint32_t
+{
+    return ( ( Tasks::IRQ == irq ) or ... ) ? std::uint32_t{ 0xFF } << shift : 0;
+}
+
+/**
+ * \brief Critical section lock (used when a priority ceiling cannot be emulated with the
+ *        NVIC peripheral).
+ */
+class Critical_Section_Lock {
+  public:
+    Critical_Section_Lock() = delete;
+
+    /**
+     * \brief Constructor.
+     */
+    explicit Critical_Section_Lock( Peripheral::NVIC & ) noexcept
+    {
+    }
+
+    Critical_Section_Lock( Critical_Section_Lock && ) = delete;
+
+    Critical_Section_Lock( Critical_Section_Lock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section_Lock() noexcept = default;
+
+    auto operator=( Critical_Section_Lock && ) = delete;
+
+    auto operator=( Critical_Section_Lock const & ) = delete;
+
+  private:
+    /**
+     * \brief The critical section guard.
+     */
+    Interrupt::Critical_Section_Guard m_guard{};
+};
+
+/**
+ * \brief Lock that does nothing (used when no task that accesses a resource can preempt
+ *        the task locking the resource).
+ */
+class Null_Lock {
+  public:
+    Null_Lock() = delete;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr explicit Null_Lock( Peripheral::NVIC & ) noexcept
+    {
+    }
+
+    Null_Lock( Null_Lock && ) = delete;
+
+    Null_Lock( Null_Lock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Null_Lock() noexcept = default;
+
+    auto operator=( Null_Lock && ) = delete;
+
+    auto operator=( Null_Lock const & ) = delete;
+};
+
+} // namespace Implementation
+
+/**
+ * \brief Statically analyzed, preemptive task application (Stack Resource Policy).
+ *
+ * Tasks and the resources they access are described at compile time. The application
+ * generates the interrupt vector table, the NVIC peripheral and SCB peripheral (SHPR
+ * register) priority configuration, and the resource locks. Each resource's ceiling is
+ * the highest priority of the tasks that access it. Locking a resource blocks every task
+ * whose priority is at or below the resource's ceiling (by disabling external interrupts
+ * through the NVIC peripheral, see picolibrary::Arm::Cortex::M0PLUS::Priority_Ceiling_Lock),
+ * so resource access is data race and deadlock free, and tasks above the ceiling are never
+ * blocked. If a system exception task's priority is above the locking task's priority
+ * and at or below the resource's ceiling, the system exception cannot be blocked through
+ * the NVIC peripheral, and the resource's lock falls back to disabling all interrupts
+ * (PRIMASK). If the locking task's priority is the resource's ceiling, the lock does
+ * nothing. The data of resources derived from
+ * picolibrary::Arm::Cortex::M0PLUS::Shared_Resource can only be accessed through a lock.
+ *
+ * \attention A lock cannot verify the context it is constructed in. A lock must only be
+ *            constructed by the handler of the task it names: naming a higher priority
+ *            task can select a lock that does not block the tasks that can preempt the
+ *            caller. Code that runs in thread mode (e.g. main()) is not a task, and must
+ *            not access resources (thread mode runs below every task, so no task's lock
+ *            protects it).
+ *
+ * Compilation fails if a task is not run by the SVCALL, PENDSV, or SYSTICK0 exception or
+ * an external interrupt, if an exception runs more than one task, if a resource is locked
+ * by a task that does not declare it, or if a resource is not accessed by any task.
+ *
+ * \tparam Tasks The tasks (picolibrary::Arm::Cortex::M0PLUS::Task specializations).
+ */
+template<typename... Tasks>
+class Application {
+  public:
+    static_assert( sizeof...( Tasks ) > 0, "an application must have at least one task" );
+
+    static_assert(
+        ( ( Tasks::IRQ >= 0 or Implementation::is_configurable_system_exception( Tasks::IRQ ) ) and ... ),
+        "tasks must be run by the SVCALL, PENDSV, or SYSTICK0 exception or an external interrupt" );
+
+    static_assert(
+        ( ( Tasks::IRQ < static_cast<Interrupt::IRQ_Number>( Interrupt::VECTORS ) - 15 ) and ... ),
+        "IRQ number out of range" );
+
+    static_assert( not Interrupt::Implementation::has_duplicate_binding<Tasks...>(), "exception runs more than one task" );
+
+    /**
+     * \brief The NVIC peripheral register values for the external interrupt tasks.
+     */
+    static constexpr auto INTERRUPT_CONTROLLER_CONFIGURATION = Implementation::make_task_interrupt_controller_configuration<Tasks...>();
+
+    Application() = delete;
+
+    Application( Application && ) = delete;
+
+    Application( Application const & ) = delete;
+
+    ~Application() = delete;
+
+    auto operator=( Application && ) = delete;
+
+    auto operator=( Application const & ) = delete;
+
+    /**
+     * \brief Get a resource's ceiling.
+     *
+     * \tparam Resource The resource.
+     *
+     * \return The highest priority of the tasks that access the resource.
+     */
+    template<typename Resource>
+    static constexpr auto ceiling() noexcept -> Interrupt_Priority
+    {
+        static_assert( ( Tasks::template uses<Resource>() or ... ), "resource not accessed by any task" );
+
+        auto ceiling = Interrupt_Priority::LOWEST;
+
+        static_cast<void>(
+            ( ( Tasks::template uses<Resource>()
+                        and to_underlying( Tasks::TASK_PRIORITY ) < to_underlying( ceiling )
+                    ? ( ceiling = Tasks::TASK_PRIORITY, true )
+                    : false )
+              or ... ) );
+
+        return ceiling;
+    }
+
+    /**
+     * \brief Build the application's interrupt vector table at compile time.
+     *
+     * \tparam DEFAULT_HANDLER The handler for entries that are not bound.
+     * \tparam Bindings Additional bindings (must include the reset exception).
+     *
+     * \param[in] stack The initial stack pointer value.
+     *
+     * \return The application's interrupt vector table.
+     */
+    template<Interrupt::Handler DEFAULT_HANDLER, typename... Bindings>
+    static constexpr auto make_vector_table( void * stack ) noexcept -> Interrupt::Vector_Table
+    {
+        return Interrupt::make_vector_table<DEFAULT_HANDLER, Tasks..., Bindings...>( stack );
+    }
+
+    /**
+     * \brief Configure the task priorities, and enable the external interrupt tasks.
+     *
+     * \param[in] nvic The NVIC peripheral instance to use.
+     * \param[in] scb The SCB peripheral instance to use.
+     */
+    static void configure( Peripheral::NVIC & nvic, Peripheral::SCB & scb ) noexcept
+    {
+        if constexpr ( SHPR2_MASK ) {
+            scb.shpr[ 0 ] = ( scb.shpr[ 0 ] & ~SHPR2_MASK ) | SHPR2;
+        } // if
+
+        if constexpr ( SHPR3_MASK ) {
+            scb.shpr[ 1 ] = ( scb.shpr[ 1 ] & ~SHPR3_MASK ) | SHPR3;
+        } // if
+
+        Interrupt_Controller<>{ nvic }.configure( INTERRUPT_CONTROLLER_CONFIGURATION );
+    }
+
+    /**
+     * \brief Resource lock RAII guard.
+     *
+     * \attention A lock must only be constructed by the handler of the task it names.
+     *
+     * \tparam Task The task locking the resource.
+     * \tparam Resource The resource to lock.
+     */
+    template<typename Task, typename Resource>
+    class Lock {
+      public:
+        static_assert( ( std::is_same_v<Task, Tasks> or ... ), "task is not part of the application" );
+
+        static_assert( Task::template uses<Resource>(), "task does not declare resource" );
+
+        Lock() = delete;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] nvic The NVIC peripheral instance to use.
+         */
+        explicit Lock( Peripheral::NVIC & nvic ) noexcept : m_lock{ nvic }
+        {
+        }
+
+        Lock( Lock && ) = delete;
+
+        Lock( Lock const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Lock() noexcept = default;
+
+        auto operator=( Lock && ) = delete;
+
+        auto operator=( Lock const & ) = delete;
+
+        /**
+         * \brief Access the data of a resource derived from
+         *        picolibrary::Arm::Cortex::M0PLUS::Shared_Resource.
+         *
+         * \tparam Locked The locked resource (deferred so that resources that do not own
+         *         data can also be locked).
+         *
+         * \param[in] resource The locked resource.
+         *
+         * \return The resource's data (must not be used after the lock is released).
+         */
+        template<typename Locked = Resource>
+        auto access( Resource & resource ) const noexcept -> typename Locked::Data &
+        {
+            static_assert( std::is_same_v<Locked, Resource>, "resource is not locked" );
+
+            return data( resource );
+        }
+
+      private:
+        /**
+         * \brief The resource's ceiling.
+         */
+        static constexpr auto CEILING = ceiling<Resource>();
+
+        /**
+         * \brief The underlying lock.
+         */
+        std::conditional_t<
+            Task::TASK_PRIORITY == CEILING,
+            Implementation::Null_Lock,
+            std::conditional_t<
+                ( ( Tasks::IRQ < 0 and to_underlying( Tasks::TASK_PRIORITY ) < to_underlying( Task::TASK_PRIORITY )
+                    and to_underlying( Tasks::TASK_PRIORITY ) >= to_underlying( CEILING ) )
+                  or ... ),
+                Implementation::Critical_Section_Lock,
+                Priority_Ceiling_Lock<make_priority_ceiling_mask( INTERRUPT_CONTROLLER_CONFIGURATION, CEILING )>>>
+            m_lock;
+    };
+
+  private:
+    /**
+     * \brief Get a resource's data.
+     *
+     * \tparam T The resource's data type.
+     *
+     * \param[in] resource The resource.
+     *
+     * \return The resource's data.
+     */
+    template<typename T>
+    static constexpr auto data( Shared_Resource<T> & resource ) noexcept -> T &
+    {
+        return resource.m_data;
+    }
+
+    /**
+     * \brief The SHPR2 register priority fields (PRI_11 is the SVCALL exception's
+     *        priority).
+     */
+    static constexpr auto SHPR2 = Implementation::shpr_field<Tasks...>( Interrupt::SVCALL_IRQ, 24 );
+
+    /**
+     * \brief The mask identifying the configured SHPR2 register priority fields.
+     */
+    static constexpr auto SHPR2_MASK = Implementation::shpr_field_mask<Tasks...>( Interrupt::SVCALL_IRQ, 24 );
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+    /**
+     * \brief The SHPR3 register priority fields (PRI_14 is the PENDSV exception's
+     *        priority, and PRI_15 is the SYSTICK0 exception's priority).
+     */
+    static constexpr auto SHPR3 = Implementation::shpr_field<Tasks...>( Interrupt::PENDSV_IRQ, 16 )
+                                  | Implementation::shpr_field<Tasks...>( Interrupt::SYSTICK0_IRQ, 24 );
+
+    /**
+     * \brief The mask identifying the configured SHPR3 register priority fields.
+     */
+    static constexpr auto SHPR3_MASK = Implementation::shpr_field_mask<Tasks...>( Interrupt::PENDSV_IRQ, 16 )
+                                       | Implementation::shpr_field_mask<Tasks...>( Interrupt::SYSTICK0_IRQ, 24 );
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+    /**
+     * \brief The SHPR3 register priority fields (PRI_14 is the PENDSV exception's
+     *        priority).
+     */
+    static constexpr auto SHPR3 = Implementation::shpr_field<Tasks...>( Interrupt::PENDSV_IRQ, 16 );
+
+    /**
+     * \brief The mask identifying the configured SHPR3 register priority fields.
+     */
+    static constexpr auto SHPR3_MASK = Implementation::shpr_field_mask<Tasks...>( Interrupt::PENDSV_IRQ, 16 );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_APPLICATION_H
@@ -0,0 +1,218 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Block_Pool interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_BLOCK_POOL_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_BLOCK_POOL_H
+
+#include <cstddef>
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Fixed block memory pool.
+ *
+ * Free blocks are kept in an intrusive free list (each free block holds a pointer to the
+ * next free block), so allocation and deallocation are O(1). The free list is only
+ * accessed with interrupts disabled, and the critical sections only cover the free list
+ * and usage statistics updates, so blocks can be allocated and deallocated from both
+ * interrupt handlers and thread mode. Separate pools should be used for separate block
+ * sizes.
+ */
+class Block_Pool {
+  public:
+    Block_Pool() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] storage The pool storage (must be aligned to alignof( std::max_align_t )).
+     * \param[in] block_size The block size (must be a non-zero multiple of
+     *            alignof( std::max_align_t )).
+     * \param[in] blocks The number of blocks.
+     */
+    Block_Pool( void * storage, std::size_t block_size, std::size_t blocks ) noexcept;
+
+    Block_Pool( Block_Pool && ) = delete;
+
+    Block_Pool( Block_Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Block_Pool() noexcept = default;
+
+    auto operator=( Block_Pool && ) = delete;
+
+    auto operator=( Block_Pool const & ) = delete;
+
+    /**
+     * \brief Get the block size.
+     *
+     * \return The block size.
+     */
+    constexpr auto block_size() const noexcept -> std::size_t
+    {
+        return m_block_size;
+    }
+
+    /**
+     * \brief Get the number of blocks.
+     *
+     * \return The number of blocks.
+     */
+    constexpr auto blocks() const noexcept -> std::size_t
+    {
+        return m_blocks;
+    }
+
+    /**
+     * \brief Get the number of allocated blocks.
+     *
+     * \return The number of allocated blocks.
+     */
+    auto allocated() const noexcept -> std::size_t
+    {
+        return m_allocated;
+    }
+
+    /**
+     * \brief Get the number of free blocks.
+     *
+     * \return The number of free blocks.
+     */
+    auto available() const noexcept -> std::size_t
+    {
+        return m_blocks - m_allocated;
+    }
+
+    /**
+     * \brief Get the largest number of blocks that have been allocated at the same time.
+     *
+     * \return The largest number of blocks that have been allocated at the same time.
+     */
+    auto high_water_mark() const noexcept -> std::size_t
+    {
+        return m_high_water_mark;
+    }
+
+    /**
+     * \brief Allocate a block (may be called from an interrupt handler).
+     *
+     * \return The allocated block.
+     * \return nullptr if the pool is exhausted.
+     */
+    auto allocate() noexcept -> void *;
+
+    /**
+     * \brief Deallocate a block (may be called from an interrupt handler).
+     *
+     * \param[in] block The block to deallocate (must have been allocated from the pool).
+     */
+    void deallocate( void * block ) noexcept;
+
+  private:
+    /**
+     * \brief Free block.
+     */
+    struct Free_Block {
+        /**
+         * \brief The next free block.
+         */
+        Free_Block * next;
+    };
+
+    /**
+     * \brief The block size.
+     */
+    std::size_t m_block_size;
+
+    /**
+     * \brief The number of blocks.
+     */
+    std::size_t m_blocks;
+
+    /**
+     * \brief The free blocks.
+     */
+    Free_Block * m_free{};
+
+    /**
+     * \brief The number of allocated blocks.
+     */
+    std::size_t volatile m_allocated{};
+
+    /**
+     * \brief The largest number of blocks that have been allocated at the same time.
+     */
+    std::size_t volatile m_high_water_mark{};
+};
+
+/**
+ * \brief Fixed block memory pool with static storage.
+ *
+ * \tparam BLOCK_SIZE The smallest block size the pool supports (rounded up to a multiple
+ *         of alignof( std::max_align_t )).
+ * \tparam BLOCKS The number of blocks.
+ */
+template<std::size_t BLOCK_SIZE, std::size_t BLOCKS>
+class Static_Block_Pool : public Block_Pool {
+  public:
+    static_assert( BLOCK_SIZE > 0, "BLOCK_SIZE must be non-zero" );
+
+    static_assert( BLOCKS > 0, "BLOCKS must be non-zero" );
+
+    /**
+     * \brief Constructor.
+     */
+    Static_Block_Pool() noexcept : Block_Pool{ m_storage, ALIGNED_BLOCK_SIZE, BLOCKS }
+    {
+    }
+
+    Static_Block_Pool( Static_Block_Pool && ) = delete;
+
+    Static_Block_Pool( Static_Block_Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Block_Pool() noexcept = default;
+
+    auto operator=( Static_Block_Pool && ) = delete;
+
+    auto operator=( Static_Block_Pool const & ) = delete;
+
+  private:
+    /**
+     * \brief The block size, rounded up to a multiple of alignof( std::max_align_t ).
+     */
+    static constexpr auto ALIGNED_BLOCK_SIZE = ( BLOCK_SIZE + alignof( std::max_align_t ) - 1 )
+                                               / alignof( std::max_align_t ) * alignof( std::max_align_t );
+
+    /**
+     * \brief The pool storage.
+     */
+    alignas( std::max_align_t ) unsigned char m_storage[ ALIGNED_BLOCK_SIZE * BLOCKS ];
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_BLOCK_POOL_H
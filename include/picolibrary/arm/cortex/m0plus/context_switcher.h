@@ -0,0 +1,174 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Thread and
+ *        picolibrary::Arm::Cortex::M0PLUS::Context_Switcher interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_CONTEXT_SWITCHER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_CONTEXT_SWITCHER_H
+
+#include <cstddef>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Thread control block.
+ *
+ * A thread runs in thread mode on its own stack (using the PSP). The thread's stack
+ * pointer is the only state kept in the thread control block, the rest of the thread's
+ * context is saved on the thread's stack.
+ */
+class Thread {
+  public:
+    /**
+     * \brief Thread entry function.
+     */
+    using Entry = void ( * )( void * context );
+
+    /**
+     * \brief The minimum stack size (the initial context: the exception frame, and
+     *        R4-R11).
+     */
+    static constexpr auto MINIMUM_STACK_SIZE = std::size_t{ 16 * 4 + 8 };
+
+    Thread() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * Builds the thread's initial context on the thread's stack so that the first context
+     * switch to the thread calls the thread's entry function.
+     *
+     * \param[in] stack The thread's stack.
+     * \param[in] stack_size The size of the thread's stack (must be at least
+     *            picolibrary::Arm::Cortex::M0PLUS::Thread::MINIMUM_STACK_SIZE plus the
+     *            thread's and interrupt handlers' stack usage).
+     * \param[in] entry The thread's entry function (must not return).
+     * \param[in] context The context to pass to the thread's entry function.
+     */
+    Thread( void * stack, std::size_t stack_size, Entry entry, void * context ) noexcept;
+
+    Thread( Thread && ) = delete;
+
+    Thread( Thread const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Thread() noexcept = default;
+
+    auto operator=( Thread && ) = delete;
+
+    auto operator=( Thread const & ) = delete;
+
+  private:
+    /**
+     * \brief The thread's saved stack pointer (must be the first member, the context
+     *        switch handlers access it at offset 0).
+     */
+    void * m_stack_pointer;
+};
+
+/**
+ * \brief PENDSV/SVCALL context switcher.
+ *
+ * Context switches are performed by the PENDSV interrupt handler, which runs at the
+ * lowest priority so that context switches are deferred until all other interrupt
+ * handlers have returned. The processor saves R0-R3, R12, LR, PC, and xPSR on the
+ * current thread's stack on exception entry, and the PENDSV interrupt handler saves
+ * R4-R11 with two STMIA instructions (R8-R11 are moved through R4-R7, since Thumb-1
+ * STMIA/LDMIA can only access R0-R7), and restores the next thread's R4-R11 the same way.
+ * The first thread is started by the SVCALL interrupt handler, which restores the
+ * thread's context and returns to thread mode using the PSP.
+ *
+ * \attention picolibrary::Arm::Cortex::M0PLUS::Context_Switcher::pendsv_handler() and
+ *            picolibrary::Arm::Cortex::M0PLUS::Context_Switcher::svcall_handler() must be
+ *            bound to the PENDSV and SVCALL interrupt vector table entries.
+ */
+class Context_Switcher {
+  public:
+    Context_Switcher() = delete;
+
+    Context_Switcher( Context_Switcher && ) = delete;
+
+    Context_Switcher( Context_Switcher const & ) = delete;
+
+    ~Context_Switcher() = delete;
+
+    auto operator=( Context_Switcher && ) = delete;
+
+    auto operator=( Context_Switcher const & ) = delete;
+
+    /**
+     * \brief Start running threads.
+     *
+     * Sets the PENDSV exception's priority to the lowest priority, and switches to the
+     * first thread using the SVCALL exception. The main stack (MSP) is used by interrupt
+     * handlers from then on.
+     *
+     * \param[in] scb The SCB peripheral instance to use.
+     * \param[in] thread The first thread.
+     *
+     * \pre interrupts are enabled (PRIMASK is clear)
+     */
+    [[noreturn]] static void start( Peripheral::SCB & scb, Thread & thread ) noexcept;
+
+    /**
+     * \brief Switch to a thread.
+     *
+     * The context switch happens when the PENDSV interrupt handler runs (immediately if
+     * called from thread mode with interrupts enabled, or after all active interrupt
+     * handlers have returned). If switch_to() is called again before the context switch
+     * happens, the last thread wins.
+     *
+     * \attention Threads must have been started (see
+     *            picolibrary::Arm::Cortex::M0PLUS::Context_Switcher::start()). Calls made
+     *            before threads have been started are ignored.
+     *
+     * \param[in] scb The SCB peripheral instance to use.
+     * \param[in] thread The thread to switch to.
+     */
+    static void switch_to( Peripheral::SCB & scb, Thread & thread ) noexcept;
+
+    /**
+     * \brief Get the running thread.
+     *
+     * \return The running thread.
+     * \return nullptr if threads have not been started.
+     */
+    static auto current_thread() noexcept -> Thread *;
+
+    /**
+     * \brief PENDSV interrupt handler (saves the running thread's context, and restores
+     *        the next thread's context).
+     */
+    static void pendsv_handler() noexcept;
+
+    /**
+     * \brief SVCALL interrupt handler (restores the first thread's context).
+     */
+    static void svcall_handler() noexcept;
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_CONTEXT_SWITCHER_H
@@ -0,0 +1,686 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Coroutine_Executor interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_COROUTINE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_COROUTINE_H
+
+#if defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/block_pool.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+#include "picolibrary/arm/cortex/m0plus/timer_wheel.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+class Coroutine;
+class Coroutine_Executor;
+
+/**
+ * \brief Coroutine promise.
+ *
+ * Coroutine frames are allocated from the frame pool of the executor that is passed as
+ * the coroutine's first parameter.
+ */
+class Coroutine_Promise {
+  public:
+    /**
+     * \brief Allocate a coroutine frame.
+     *
+     * \tparam Arguments The coroutine's remaining parameter types.
+     *
+     * \param[in] size The coroutine frame size.
+     * \param[in] executor The executor whose frame pool the frame should be allocated
+     *            from.
+     *
+     * \return The allocated coroutine frame.
+     * \return nullptr if the executor's frame pool is exhausted, or the frame does not fit
+     *         in a frame pool block.
+     */
+    template<typename... Arguments>
+    static auto operator new( std::size_t size, Coroutine_Executor & executor, Arguments &... ) noexcept -> void *;
+
+    /**
+     * \brief Deallocate a coroutine frame.
+     *
+     * \param[in] frame The coroutine frame to deallocate.
+     * \param[in] size The coroutine frame size.
+     */
+    static void operator delete( void * frame, std::size_t size ) noexcept;
+
+    /**
+     * \brief Get the coroutine returned if the coroutine frame cannot be allocated.
+     *
+     * \return An empty coroutine.
+     */
+    static auto get_return_object_on_allocation_failure() noexcept -> Coroutine;
+
+    Coroutine_Promise() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Arguments The coroutine's remaining parameter types.
+     *
+     * \param[in] executor The executor that runs the coroutine.
+     */
+    template<typename... Arguments>
+    explicit Coroutine_Promise( Coroutine_Executor & executor, Arguments &... ) noexcept :
+        m_executor{ &executor }
+    {
+    }
+
+    Coroutine_Promise( Coroutine_Promise && ) = delete;
+
+    Coroutine_Promise( Coroutine_Promise const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Coroutine_Promise() noexcept = default;
+
+    auto operator=( Coroutine_Promise && ) = delete;
+
+    auto operator=( Coroutine_Promise const & ) = delete;
+
+    /**
+     * \brief Get the coroutine.
+     *
+     * \return The coroutine.
+     */
+    auto get_return_object() noexcept -> Coroutine;
+
+    /**
+     * \brief Suspend the coroutine until it is spawned.
+     *
+     * \return std::suspend_always.
+     */
+    auto initial_suspend() const noexcept -> std::suspend_always
+    {
+        return {};
+    }
+
+    /**
+     * \brief Destroy the coroutine when it completes.
+     *
+     * \return std::suspend_never.
+     */
+    auto final_suspend() const noexcept -> std::suspend_never
+    {
+        return {};
+    }
+
+    /**
+     * \brief Handle the coroutine's completion.
+     */
+    void return_void() const noexcept
+    {
+    }
+
+    /**
+     * \brief Handle an exception that escapes the coroutine (exceptions are not used).
+     */
+    void unhandled_exception() const noexcept
+    {
+    }
+
+    /**
+     * \brief Get the executor that runs the coroutine.
+     *
+     * \return The executor that runs the coroutine.
+     */
+    auto executor() const noexcept -> Coroutine_Executor &
+    {
+        return *m_executor;
+    }
+
+  private:
+    friend class Coroutine_Executor;
+
+    /**
+     * \brief The executor that runs the coroutine.
+     */
+    Coroutine_Executor * m_executor;
+
+    /**
+     * \brief The next coroutine in the executor's ready queue.
+     */
+    Coroutine_Promise * m_next{};
+};
+
+/**
+ * \brief Coroutine (fire and forget) run by a
+ *        picolibrary::Arm::Cortex::M0PLUS::Coroutine_Executor.
+ *
+ * A coroutine function returns picolibrary::Arm::Cortex::M0PLUS::Coroutine, and its first
+ * parameter is the executor that runs it. The coroutine does not start running until it
+ * is spawned, and its frame is deallocated when it completes.
+ */
+class Coroutine {
+  public:
+    /**
+     * \brief Coroutine promise type.
+     */
+    using promise_type = Coroutine_Promise;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Coroutine() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] handle The coroutine handle.
+     */
+    constexpr explicit Coroutine( std::coroutine_handle<Coroutine_Promise> handle ) noexcept :
+        m_handle{ handle }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Coroutine( Coroutine && source ) noexcept : m_handle{ source.m_handle }
+    {
+        source.m_handle = {};
+    }
+
+    Coroutine( Coroutine const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * Destroys the coroutine if it was not spawned.
+     */
+    ~Coroutine() noexcept
+    {
+        if ( m_handle ) {
+            m_handle.destroy();
+        } // if
+    }
+
+    auto operator=( Coroutine && ) = delete;
+
+    auto operator=( Coroutine const & ) = delete;
+
+    /**
+     * \brief Check if the coroutine frame was allocated.
+     *
+     * \return true if the coroutine frame was allocated.
+     * \return false if the coroutine frame could not be allocated, or the coroutine was
+     *         spawned.
+     */
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool>( m_handle );
+    }
+
+  private:
+    friend class Coroutine_Executor;
+
+    /**
+     * \brief The coroutine handle.
+     */
+    std::coroutine_handle<Coroutine_Promise> m_handle{};
+};
+
+/**
+ * \brief Coroutine executor.
+ *
+ * The executor allocates coroutine frames from a fixed block frame pool (see
+ * picolibrary::Arm::Cortex::M0PLUS::Block_Pool), and resumes ready coroutines.
+ * Awaitables complete from interrupt handlers by scheduling the coroutine waiting on them,
+ * which queues the coroutine in the executor's ready queue. If the executor was
+ * constructed with an SCB peripheral instance, scheduling a coroutine also pends the
+ * PENDSV exception, and
+ * picolibrary::Arm::Cortex::M0PLUS::Coroutine_Executor::run() must be called by the
+ * PENDSV interrupt handler (whose priority should be the lowest priority). Otherwise,
+ * picolibrary::Arm::Cortex::M0PLUS::Coroutine_Executor::run() must be called from thread
+ * mode (e.g. a main loop). Coroutines are never resumed from the interrupt handler that
+ * completes the awaitable.
+ */
+class Coroutine_Executor {
+  public:
+    /**
+     * \brief The size of the header that precedes each coroutine frame in a frame pool
+     *        block.
+     */
+    static constexpr auto FRAME_HEADER_SIZE = alignof( std::max_align_t );
+
+    Coroutine_Executor() = delete;
+
+    /**
+     * \brief Constructor (coroutines are resumed from thread mode).
+     *
+     * \param[in] frame_pool The frame pool storage (must be aligned to
+     *            alignof( std::max_align_t )).
+     * \param[in] block_size The frame pool block size (must be a multiple of
+     *            alignof( std::max_align_t )).
+     * \param[in] blocks The number of frame pool blocks.
+     */
+    Coroutine_Executor( void * frame_pool, std::size_t block_size, std::size_t blocks ) noexcept;
+
+    /**
+     * \brief Constructor (coroutines are resumed from the PENDSV interrupt handler).
+     *
+     * Sets the PENDSV exception's priority to the lowest priority.
+     *
+     * \param[in] scb The SCB peripheral instance to use.
+     * \param[in] frame_pool The frame pool storage (must be aligned to
+     *            alignof( std::max_align_t )).
+     * \param[in] block_size The frame pool block size (must be a multiple of
+     *            alignof( std::max_align_t )).
+     * \param[in] blocks The number of frame pool blocks.
+     */
+    Coroutine_Executor( Peripheral::SCB & scb, void * frame_pool, std::size_t block_size, std::size_t blocks ) noexcept;
+
+    Coroutine_Executor( Coroutine_Executor && ) = delete;
+
+    Coroutine_Executor( Coroutine_Executor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Coroutine_Executor() noexcept = default;
+
+    auto operator=( Coroutine_Executor && ) = delete;
+
+    auto operator=( Coroutine_Executor const & ) = delete;
+
+    /**
+     * \brief Spawn a coroutine (schedule its first resumption).
+     *
+     * \param[in] coroutine The coroutine to spawn.
+     *
+     * \return true if the coroutine was spawned.
+     * \return false if the coroutine's frame could not be allocated.
+     */
+    auto spawn( Coroutine && coroutine ) noexcept -> bool;
+
+    /**
+     * \brief Schedule a suspended coroutine's resumption (may be called from an interrupt
+     *        handler).
+     *
+     * \param[in] promise The suspended coroutine's promise.
+     */
+    void schedule( Coroutine_Promise & promise ) noexcept;
+
+    /**
+     * \brief Resume ready coroutines until the ready queue is empty.
+     */
+    void run() noexcept;
+
+    /**
+     * \brief Allocate a coroutine frame.
+     *
+     * \param[in] size The coroutine frame size.
+     *
+     * \return The allocated coroutine frame.
+     * \return nullptr if the frame pool is exhausted, or the frame does not fit in a frame
+     *         pool block.
+     */
+    auto allocate( std::size_t size ) noexcept -> void *;
+
+    /**
+     * \brief Deallocate a coroutine frame.
+     *
+     * \param[in] frame The coroutine frame to deallocate.
+     */
+    static void deallocate( void * frame ) noexcept;
+
+    /**
+     * \brief Get the frame pool.
+     *
+     * \return The frame pool.
+     */
+    constexpr auto frame_pool() const noexcept -> Block_Pool const &
+    {
+        return m_frame_pool;
+    }
+
+  private:
+    /**
+     * \brief The SCB peripheral instance (nullptr if coroutines are resumed from thread
+     *        mode).
+     */
+    Peripheral::SCB * m_scb{};
+
+    /**
+     * \brief The frame pool.
+     */
+    Block_Pool m_frame_pool;
+
+    /**
+     * \brief The oldest ready coroutine.
+     */
+    Coroutine_Promise * m_head{};
+
+    /**
+     * \brief The newest ready coroutine.
+     */
+    Coroutine_Promise * m_tail{};
+};
+
+/**
+ * \brief Coroutine executor with static frame pool storage.
+ *
+ * \tparam FRAME_SIZE The largest coroutine frame size the executor supports.
+ * \tparam FRAMES The number of coroutine frames in the frame pool.
+ */
+template<std::size_t FRAME_SIZE, std::size_t FRAMES>
+class Static_Coroutine_Executor : public Coroutine_Executor {
+  public:
+    static_assert( FRAMES > 0, "FRAMES must be non-zero" );
+
+    /**
+     * \brief Constructor (coroutines are resumed from thread mode).
+     */
+    Static_Coroutine_Executor() noexcept : Coroutine_Executor{ m_frame_pool, BLOCK_SIZE, FRAMES }
+    {
+    }
+
+    /**
+     * \brief Constructor (coroutines are resumed from the PENDSV interrupt handler).
+     *
+     * \param[in] scb The SCB peripheral instance to use.
+     */
+    explicit Static_Coroutine_Executor( Peripheral::SCB & scb ) noexcept :
+        Coroutine_Executor{ scb, m_frame_pool, BLOCK_SIZE, FRAMES }
+    {
+    }
+
+    Static_Coroutine_Executor( Static_Coroutine_Executor && ) = delete;
+
+    Static_Coroutine_Executor( Static_Coroutine_Executor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Coroutine_Executor() noexcept = default;
+
+    auto operator=( Static_Coroutine_Executor && ) = delete;
+
+    auto operator=( Static_Coroutine_Executor const & ) = delete;
+
+  private:
+    /**
+     * \brief The frame pool block size.
+     */
+    static constexpr auto BLOCK_SIZE = FRAME_HEADER_SIZE
+                                       + ( FRAME_SIZE + FRAME_HEADER_SIZE - 1 ) / FRAME_HEADER_SIZE * FRAME_HEADER_SIZE;
+
+    /**
+     * \brief The frame pool storage.
+     */
+    alignas( std::max_align_t ) unsigned char m_frame_pool[ BLOCK_SIZE * FRAMES ];
+};
+
+template<typename... Arguments>
+auto Coroutine_Promise::operator new( std::size_t size, Coroutine_Executor & executor, Arguments &... ) noexcept -> void *
+{
+    return executor.allocate( size );
+}
+
+inline void Coroutine_Promise::operator delete( void * frame, std::size_t ) noexcept
+{
+    Coroutine_Executor::deallocate( frame );
+}
+
+inline auto Coroutine_Promise::get_return_object_on_allocation_failure() noexcept -> Coroutine
+{
+    return Coroutine{};
+}
+
+inline auto Coroutine_Promise::get_return_object() noexcept -> Coroutine
+{
+    return Coroutine{ std::coroutine_handle<Coroutine_Promise>::from_promise( *this ) };
+}
+
+/**
+ * \brief Interrupt event awaitable.
+ *
+ * An interrupt handler signals the event (e.g. "IRQ N fired"), and a single coroutine
+ * awaits it. A signal that occurs while no coroutine is waiting is latched, and completes
+ * the next await immediately.
+ */
+class Interrupt_Event {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Interrupt_Event() noexcept = default;
+
+    Interrupt_Event( Interrupt_Event && ) = delete;
+
+    Interrupt_Event( Interrupt_Event const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Interrupt_Event() noexcept = default;
+
+    auto operator=( Interrupt_Event && ) = delete;
+
+    auto operator=( Interrupt_Event const & ) = delete;
+
+    /**
+     * \brief Signal the event (schedule the waiting coroutine's resumption, or latch the
+     *        signal if no coroutine is waiting).
+     */
+    void signal() noexcept
+    {
+        Coroutine_Promise * waiter;
+
+        {
+            Interrupt::Critical_Section_Guard const guard;
+
+            waiter = m_waiter;
+
+            m_waiter   = nullptr;
+            m_signaled = not waiter;
+        }
+
+        if ( waiter ) {
+            waiter->executor().schedule( *waiter );
+        } // if
+    }
+
+    /**
+     * \brief Check if a latched signal is pending (consumes the signal).
+     *
+     * \return true if a latched signal was pending.
+     * \return false if no latched signal was pending.
+     */
+    auto await_ready() noexcept -> bool
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        return consume();
+    }
+
+    /**
+     * \brief Wait for the event to be signaled.
+     *
+     * \param[in] handle The awaiting coroutine.
+     *
+     * \return true if the coroutine should be suspended.
+     * \return false if the event was signaled after
+     *         picolibrary::Arm::Cortex::M0PLUS::Interrupt_Event::await_ready() was called.
+     */
+    auto await_suspend( std::coroutine_handle<Coroutine_Promise> handle ) noexcept -> bool
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        if ( consume() ) {
+            return false;
+        } // if
+
+        m_waiter = &handle.promise();
+
+        return true;
+    }
+
+    /**
+     * \brief Complete the await.
+     */
+    void await_resume() const noexcept
+    {
+    }
+
+  private:
+    /**
+     * \brief The waiting coroutine.
+     */
+    Coroutine_Promise * m_waiter{};
+
+    /**
+     * \brief A signal occurred while no coroutine was waiting.
+     */
+    bool m_signaled{};
+
+    /**
+     * \brief Consume a latched signal.
+     *
+     * \return true if a latched signal was pending.
+     * \return false if no latched signal was pending.
+     */
+    auto consume() noexcept -> bool
+    {
+        auto const signaled = m_signaled;
+
+        m_signaled = false;
+
+        return signaled;
+    }
+};
+
+/**
+ * \brief Timer wheel delay awaitable (completed by the SYSTICK interrupt handler that
+ *        drives the timer wheel).
+ *
+ * \tparam SLOTS The number of timer wheel slots.
+ */
+template<std::size_t SLOTS>
+class Delay {
+  public:
+    Delay() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] timer_wheel The timer wheel to use.
+     * \param[in] ticks The number of timer wheel ticks to wait for (must be non-zero).
+     */
+    constexpr Delay( Timer_Wheel<SLOTS> & timer_wheel, std::uint32_t ticks ) noexcept :
+        m_timer_wheel{ &timer_wheel },
+        m_ticks{ ticks }
+    {
+    }
+
+    Delay( Delay && ) = delete;
+
+    Delay( Delay const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Delay() noexcept = default;
+
+    auto operator=( Delay && ) = delete;
+
+    auto operator=( Delay const & ) = delete;
+
+    /**
+     * \brief Check if the delay has completed.
+     *
+     * \return false.
+     */
+    constexpr auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    /**
+     * \brief Start the delay.
+     *
+     * \param[in] handle The awaiting coroutine.
+     */
+    void await_suspend( std::coroutine_handle<Coroutine_Promise> handle ) noexcept
+    {
+        m_promise = &handle.promise();
+
+        m_timer_wheel->start( m_timer, m_ticks );
+    }
+
+    /**
+     * \brief Complete the await.
+     */
+    void await_resume() const noexcept
+    {
+    }
+
+  private:
+    /**
+     * \brief The timer wheel.
+     */
+    Timer_Wheel<SLOTS> * m_timer_wheel;
+
+    /**
+     * \brief The number of timer wheel ticks to wait for.
+     */
+    std::uint32_t m_ticks;
+
+    /**
+     * \brief The awaiting coroutine.
+     */
+    Coroutine_Promise * m_promise{};
+
+    /**
+     * \brief The timer.
+     */
+    Software_Timer m_timer{ expire, this };
+
+    /**
+     * \brief Schedule the awaiting coroutine's resumption.
+     *
+     * \param[in] context The delay.
+     */
+    static void expire( void * context ) noexcept
+    {
+        auto & promise = *static_cast<Delay *>( context )->m_promise;
+
+        promise.executor().schedule( promise );
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // defined( __cpp_impl_coroutine )
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_COROUTINE_H
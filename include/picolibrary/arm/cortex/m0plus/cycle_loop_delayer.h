@@ -0,0 +1,215 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Cycle_Loop_Delayer interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_CYCLE_LOOP_DELAYER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_CYCLE_LOOP_DELAYER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Blocking delayer that delays by executing a cycle counted loop.
+ *
+ * The delayer does not use any peripherals. Each loop iteration (SUBS, taken BNE) takes
+ * picolibrary::Arm::Cortex::M0PLUS::Cycle_Loop_Delayer::CYCLES_PER_ITERATION processor
+ * clock cycles when instructions are fetched without wait states. If instruction fetches
+ * incur wait states, the delayer can be calibrated against the SYSTICK peripheral.
+ *
+ * \attention Delays are minimums: interrupts that occur while a delay is in progress
+ *            extend the delay.
+ */
+class Cycle_Loop_Delayer {
+  public:
+    /**
+     * \brief The number of processor clock cycles in a loop iteration when instructions
+     *        are fetched without wait states.
+     */
+    static constexpr auto CYCLES_PER_ITERATION = std::uint32_t{ 3 };
+
+    /**
+     * \brief The number of loop iterations to measure during calibration.
+     */
+    static constexpr auto CALIBRATION_ITERATIONS = std::uint32_t{ 256 };
+
+    /**
+     * \brief The approximate number of loop iterations that the fixed overhead of a delay
+     *        (call, scale check, zero check, and return) takes.
+     */
+    static constexpr auto CALL_OVERHEAD_ITERATIONS = std::uint32_t{ 4 };
+
+    /**
+     * \brief Convert a duration to a number of loop iterations.
+     *
+     * \tparam CLOCK_FREQUENCY The processor clock frequency (Hz).
+     * \tparam Rep The duration's representation.
+     * \tparam Period The duration's period.
+     *
+     * \param[in] duration The duration to convert.
+     *
+     * \return The number of loop iterations in the duration, rounded to the nearest
+     *         iteration, less
+     *         picolibrary::Arm::Cortex::M0PLUS::Cycle_Loop_Delayer::CALL_OVERHEAD_ITERATIONS.
+     */
+    template<std::uint32_t CLOCK_FREQUENCY, typename Rep, typename Period>
+    static constexpr auto iterations( std::chrono::duration<Rep, Period> duration ) noexcept -> std::uint32_t
+    {
+        auto const iterations = ( std::uintmax_t{ CLOCK_FREQUENCY }
+                                      * static_cast<std::uintmax_t>( duration.count() ) * Period::num
+                                  + Period::den * CYCLES_PER_ITERATION / 2 )
+                                / ( Period::den * CYCLES_PER_ITERATION );
+
+        return iterations > CALL_OVERHEAD_ITERATIONS
+                   ? static_cast<std::uint32_t>( iterations - CALL_OVERHEAD_ITERATIONS )
+                   : 0;
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Cycle_Loop_Delayer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Cycle_Loop_Delayer( Cycle_Loop_Delayer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Cycle_Loop_Delayer( Cycle_Loop_Delayer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Cycle_Loop_Delayer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Cycle_Loop_Delayer && expression ) noexcept -> Cycle_Loop_Delayer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Cycle_Loop_Delayer const & expression ) noexcept
+        -> Cycle_Loop_Delayer & = default;
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+    /**
+     * \brief Calibrate the delayer against the SYSTICK peripheral.
+     *
+     * \param[in] systick The running SYSTICK peripheral instance to calibrate the delayer
+     *            against. The SYSTICK peripheral counter must be clocked by the processor
+     *            clock, and its period must be longer than
+     *            picolibrary::Arm::Cortex::M0PLUS::Cycle_Loop_Delayer::CALIBRATION_ITERATIONS
+     *            loop iterations. The SYSTICK peripheral's registers are not written.
+     */
+    void calibrate( Peripheral::SYSTICK const & systick ) noexcept;
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+    /**
+     * \brief Delay.
+     *
+     * \param[in] iterations The number of nominal (uncalibrated) loop iterations to delay
+     *            for.
+     */
+    void operator()( std::uint32_t iterations ) const noexcept
+    {
+        if ( m_scale == UNITY_SCALE ) {
+            loop( iterations );
+            return;
+        } // if
+
+        // the scale factor never exceeds unity, so splitting the multiplication keeps both
+        // products within 32 bits and avoids a 64-bit multiplication
+        loop( ( iterations >> SCALE_FRACTION_BITS ) * m_scale
+              + ( ( ( iterations & ( UNITY_SCALE - 1 ) ) * m_scale ) >> SCALE_FRACTION_BITS ) );
+    }
+
+  private:
+    /**
+     * \brief The number of fractional bits in the calibration scale factor.
+     */
+    static constexpr auto SCALE_FRACTION_BITS = std::uint_fast8_t{ 16 };
+
+    /**
+     * \brief The calibration scale factor used when instruction fetches do not incur wait
+     *        states.
+     */
+    static constexpr auto UNITY_SCALE = std::uint32_t{ 1 } << SCALE_FRACTION_BITS;
+
+    /**
+     * \brief The ratio of nominal loop iteration duration to actual loop iteration
+     *        duration (unsigned Q16.16, never greater than unity).
+     */
+    std::uint32_t m_scale{ UNITY_SCALE };
+
+    /**
+     * \brief Execute the cycle counted loop.
+     *
+     * \param[in] iterations The number of loop iterations to execute.
+     */
+    static void loop( std::uint32_t iterations ) noexcept
+    {
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+        // the loop is not cycle counted on the host, the fence keeps it from being
+        // optimized away
+        for ( ; iterations; --iterations ) {
+            std::atomic_signal_fence( std::memory_order_seq_cst );
+        } // for
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+        if ( iterations ) {
+            asm volatile(
+                ".syntax unified            \n\t"
+                "1:                         \n\t"
+                "    subs %[iterations], #1 \n\t"
+                "    bne  1b                \n\t"
+                : [iterations] "+l"( iterations )
+                :
+                : "cc" );
+        } // if
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_CYCLE_LOOP_DELAYER_H
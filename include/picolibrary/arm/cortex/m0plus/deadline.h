@@ -0,0 +1,183 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Deadline interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_DEADLINE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_DEADLINE_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/uptime_clock.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+/**
+ * \brief Deadline bound to a picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock.
+ */
+class Deadline {
+  public:
+    /**
+     * \brief Clock tick count (SYSTICK peripheral clock cycles).
+     */
+    using Ticks = Uptime_Clock::Ticks;
+
+    Deadline() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] uptime_clock The uptime clock the deadline is bound to.
+     * \param[in] timeout The number of SYSTICK peripheral counter clock cycles from now
+     *            until the deadline expires.
+     */
+    Deadline( Uptime_Clock const & uptime_clock, Ticks timeout ) noexcept :
+        m_uptime_clock{ &uptime_clock },
+        m_expiration{ uptime_clock.now() + timeout }
+    {
+    }
+
+    /**
+     * \brief Get the uptime clock time at which the deadline expires.
+     *
+     * \return The uptime clock time at which the deadline expires.
+     */
+    constexpr auto expiration() const noexcept -> Ticks
+    {
+        return m_expiration;
+    }
+
+    /**
+     * \brief Check if the deadline has expired.
+     *
+     * \return true if the deadline has expired.
+     * \return false if the deadline has not expired.
+     */
+    auto has_expired() const noexcept -> bool
+    {
+        return m_uptime_clock->now() >= m_expiration;
+    }
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter clock cycles remaining until
+     *        the deadline expires.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles remaining until the
+     *         deadline expires (0 if the deadline has expired).
+     */
+    auto remaining() const noexcept -> Ticks
+    {
+        auto const now = m_uptime_clock->now();
+
+        return now >= m_expiration ? 0 : m_expiration - now;
+    }
+
+  private:
+    /**
+     * \brief The uptime clock the deadline is bound to.
+     */
+    Uptime_Clock const * m_uptime_clock;
+
+    /**
+     * \brief The uptime clock time at which the deadline expires.
+     */
+    Ticks m_expiration;
+};
+
+/**
+ * \brief Register polling mode.
+ */
+enum class Poll_Mode : std::uint_fast8_t {
+    SPIN,           ///< Poll continuously.
+    WAIT_FOR_EVENT, ///< Wait for an event (WFE) between polls.
+};
+
+/**
+ * \brief Poll a register until a field has a specific value or a deadline expires.
+ *
+ * If the deadline expires, the register is checked one final time so that a poll that
+ * was preempted past the deadline does not report a false timeout.
+ *
+ * \tparam Register The type of register to poll.
+ *
+ * \param[in] reg The register to poll.
+ * \param[in] mask The mask identifying the field to check.
+ * \param[in] value The field value to wait for.
+ * \param[in] deadline The deadline.
+ * \param[in] mode The polling mode. If
+ *            picolibrary::Arm::Cortex::M0PLUS::Poll_Mode::WAIT_FOR_EVENT is used, the
+ *            processor sleeps until the next event between polls. Every
+ *            exception entry (including the SYSTICK interrupt that drives the uptime
+ *            clock) is an event, so the deadline is checked at least once per SYSTICK
+ *            peripheral counter period.
+ *
+ * \return true if the field has the requested value.
+ * \return false if the deadline expired before the field had the requested value.
+ */
+template<typename Register>
+auto poll_until(
+    Register const &        reg,
+    typename Register::Type mask,
+    typename Register::Type value,
+    Deadline const &        deadline,
+    Poll_Mode               mode = Poll_Mode::SPIN ) noexcept -> bool
+{
+    for ( ;; ) {
+        if ( ( static_cast<typename Register::Type>( reg ) & mask ) == value ) {
+            return true;
+        } // if
+
+        if ( deadline.has_expired() ) {
+            return ( static_cast<typename Register::Type>( reg ) & mask ) == value;
+        } // if
+
+        if ( mode == Poll_Mode::WAIT_FOR_EVENT ) {
+            wait_for_event();
+        } // if
+    }     // for
+}
+
+/**
+ * \brief Poll a register until all of the bits in a mask are set or a deadline expires.
+ *
+ * \tparam Register The type of register to poll.
+ *
+ * \param[in] reg The register to poll.
+ * \param[in] mask The mask identifying the bits to wait for.
+ * \param[in] deadline The deadline.
+ * \param[in] mode The polling mode.
+ *
+ * \return true if all of the bits in the mask are set.
+ * \return false if the deadline expired before all of the bits in the mask were set.
+ */
+template<typename Register>
+auto poll_until( Register const & reg, typename Register::Type mask, Deadline const & deadline, Poll_Mode mode = Poll_Mode::SPIN ) noexcept
+    -> bool
+{
+    return poll_until( reg, mask, mask, deadline, mode );
+}
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_DEADLINE_H
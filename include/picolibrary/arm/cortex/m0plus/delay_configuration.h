@@ -0,0 +1,140 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Delay_Configuration interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_DELAY_CONFIGURATION_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_DELAY_CONFIGURATION_H
+
+#include <cstdint>
+#include <limits>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief SYSTICK peripheral counter reload value and reload count for a blocking delay,
+ *        computed at compile time.
+ *
+ * The delay is split into the fewest reloads that divide it exactly into SYSTICK
+ * peripheral counter periods. If no such split is found among the candidates that are
+ * searched, the fewest possible reloads are used, and the reload value is rounded to the
+ * nearest SYSTICK peripheral counter clock cycle.
+ *
+ * \tparam CLOCK_FREQUENCY The SYSTICK peripheral counter clock frequency (Hz).
+ * \tparam Duration The std::chrono::duration specialization used to express the delay
+ *         duration.
+ * \tparam DURATION The delay duration.
+ */
+template<std::uint32_t CLOCK_FREQUENCY, typename Duration, typename Duration::rep DURATION>
+class Delay_Configuration {
+  private:
+    static_assert( CLOCK_FREQUENCY > 0 );
+
+    static_assert( DURATION > 0 );
+
+    static_assert(
+        static_cast<std::uintmax_t>( DURATION )
+            <= std::numeric_limits<std::uintmax_t>::max() / CLOCK_FREQUENCY / Duration::period::num,
+        "delay duration overflows the cycle count" );
+
+    /**
+     * \brief The maximum number of SYSTICK peripheral counter clock cycles in a SYSTICK
+     *        peripheral counter period.
+     */
+    static constexpr auto PERIOD_MAX = std::uintmax_t{ Peripheral::SYSTICK::RVR::Mask::RELOAD } + 1;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles in the delay.
+     */
+    static constexpr auto CYCLES =
+        ( std::uintmax_t{ CLOCK_FREQUENCY } * static_cast<std::uintmax_t>( DURATION )
+              * Duration::period::num
+          + Duration::period::den / 2 )
+        / Duration::period::den;
+
+    static_assert( CYCLES > 0, "delay duration is shorter than a SYSTICK peripheral counter clock cycle" );
+
+  public:
+    /**
+     * \brief The number of SYSTICK peripheral counter reloads required to create the
+     *        delay.
+     */
+    static constexpr auto TICKS = []() constexpr {
+        auto const ticks_min = ( CYCLES + PERIOD_MAX - 1 ) / PERIOD_MAX;
+
+        // bound the search to keep compile times reasonable for long delays
+        for ( auto ticks = ticks_min; ticks < ticks_min + 256 and ticks <= CYCLES; ++ticks ) {
+            if ( CYCLES % ticks == 0 ) {
+                return ticks;
+            } // if
+        }     // for
+
+        return ticks_min;
+    }();
+
+    /**
+     * \brief The SYSTICK peripheral counter reload value required to create the delay.
+     */
+    static constexpr auto RELOAD_VALUE = ( CYCLES + TICKS / 2 ) / TICKS - 1;
+
+    static_assert( RELOAD_VALUE > 0, "delay duration is too short" );
+
+    static_assert(
+        RELOAD_VALUE <= Peripheral::SYSTICK::RVR::Mask::RELOAD,
+        "reload value does not fit in SYSTICK::RVR::RELOAD" );
+
+    static_assert(
+        TICKS <= std::numeric_limits<std::uint32_t>::max(),
+        "delay duration is too long" );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Delay_Configuration() noexcept = default;
+
+    /**
+     * \brief Get the SYSTICK peripheral counter reload value required to create the
+     *        delay.
+     *
+     * \return The SYSTICK peripheral counter reload value required to create the delay.
+     */
+    constexpr auto reload_value() const noexcept -> std::uint32_t
+    {
+        return RELOAD_VALUE;
+    }
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter reloads required to create the
+     *        delay.
+     *
+     * \return The number of SYSTICK peripheral counter reloads required to create the
+     *         delay.
+     */
+    constexpr auto ticks() const noexcept -> std::uint32_t
+    {
+        return TICKS;
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_DELAY_CONFIGURATION_H
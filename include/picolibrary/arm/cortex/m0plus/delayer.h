@@ -25,7 +25,10 @@
 
 #include <cstdint>
 
+#include "picolibrary/arm/cortex/m0plus/delay_configuration.h"
 #include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/systick_calibration.h"
+#include "picolibrary/arm/cortex/m0plus/systick_clock_source.h"
 #include "picolibrary/utility.h"
 
 namespace picolibrary::Arm::Cortex::M0PLUS {
@@ -38,10 +41,7 @@ class Delayer {
     /**
      * \brief SYSTICK clock source.
      */
-    enum class Clock_Source : std::uint32_t {
-        EXTERNAL_REFERENCE_CLOCK = 0 << Peripheral::SYSTICK::CSR::Bit::CLKSOURCE, ///< External reference clock.
-        PROCESSOR_CLOCK = 1 << Peripheral::SYSTICK::CSR::Bit::CLKSOURCE, ///< Processor clock.
-    };
+    using Clock_Source = SYSTICK_Clock_Source;
 
     /**
      * \brief Constructor.
@@ -72,6 +72,45 @@ class Delayer {
         m_systick->csr = to_underlying( clock_source ) | Peripheral::SYSTICK::CSR::Mask::ENABLE;
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \tparam CLOCK_FREQUENCY The SYSTICK peripheral counter clock frequency (Hz).
+     * \tparam Duration The std::chrono::duration specialization used to express the
+     *         delay duration.
+     * \tparam DURATION The delay duration.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to create blocking
+     *            delays.
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] configuration The compile time SYSTICK peripheral counter configuration
+     *            for blocking delays of the desired duration.
+     *
+     * \attention The delayer will use the processor clock if the external reference clock
+     *            is requested but is not available.
+     */
+    template<std::uint32_t CLOCK_FREQUENCY, typename Duration, typename Duration::rep DURATION>
+    constexpr Delayer( Peripheral::SYSTICK & systick, Clock_Source clock_source, Delay_Configuration<CLOCK_FREQUENCY, Duration, DURATION> configuration ) noexcept
+        :
+        Delayer{ systick, clock_source, configuration.reload_value(), configuration.ticks() }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to create blocking
+     *            delays.
+     * \param[in] configuration The run time SYSTICK peripheral counter configuration for
+     *            blocking delays of the desired duration (see
+     *            picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Calibration::configure()).
+     */
+    constexpr Delayer( Peripheral::SYSTICK & systick, SYSTICK_Counter_Configuration const & configuration ) noexcept
+        :
+        Delayer{ systick, configuration.clock_source, configuration.reload_value, configuration.ticks }
+    {
+    }
+
     /**
      * \brief Constructor.
      *
@@ -117,6 +156,27 @@ class Delayer {
 
     auto operator=( Delayer const & ) = delete;
 
+    /**
+     * \brief Change the delay configuration (e.g. after the processor clock frequency
+     *        changes) without reconstructing the delayer.
+     *
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use to
+     *            create blocking delays of the desired duration.
+     * \param[in] ticks The number of SYSTICK peripheral counter reloads required to
+     *            create blocking delays of the desired duration.
+     */
+    constexpr void reconfigure( Clock_Source clock_source, std::uint32_t reload_value, std::uint32_t ticks ) noexcept
+    {
+        m_ticks = ticks;
+
+        if ( m_systick ) {
+            m_systick->rvr = reload_value;
+            m_systick->cvr = 0;
+            m_systick->csr = to_underlying( clock_source ) | Peripheral::SYSTICK::CSR::Mask::ENABLE;
+        } // if
+    }
+
     /**
      * \brief Delay.
      */
@@ -23,7 +23,10 @@
 #ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_H
 #define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_H
 
+#include <cstdint>
+
 #include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
 
 /**
  * \brief Arm Cortex-M0+ interrupt facilities.
@@ -35,6 +38,23 @@ namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt {
  */
 using Handler = void ( * )();
 
+/**
+ * \brief Interrupt handler that calls a member function of a specific object.
+ *
+ * The object and member function are bound at compile time, so the handler calls the
+ * member function directly with the object's address as a constant, without loading the
+ * object's address from a global pointer or checking it for null.
+ *
+ * \tparam OBJECT The object whose member function should be called (must have static
+ *         storage duration).
+ * \tparam MEMBER The member function to call.
+ */
+template<auto & OBJECT, auto MEMBER>
+void member_handler() noexcept
+{
+    ( OBJECT.*MEMBER )();
+}
+
 #define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_VECTOR_TABLE_ALIGNMENT alignas( 256 )
 
 /**
@@ -131,6 +151,45 @@ struct PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_VECTOR_TABLE_ALIGNMENT Vector_Tab
 #include "picolibrary/arm/cortex/m0plus/implementation/interrupt/vectors.h"
 };
 
+/**
+ * \brief Critical section guard.
+ *
+ * The guard saves the PRIMASK register and disables interrupts when it is constructed,
+ * and restores the PRIMASK register when it is destroyed. Guards can be nested.
+ */
+class Critical_Section_Guard {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section_Guard() noexcept : m_primask{ read_primask() }
+    {
+        disable_interrupts();
+    }
+
+    Critical_Section_Guard( Critical_Section_Guard && ) = delete;
+
+    Critical_Section_Guard( Critical_Section_Guard const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section_Guard() noexcept
+    {
+        write_primask( m_primask );
+    }
+
+    auto operator=( Critical_Section_Guard && ) = delete;
+
+    auto operator=( Critical_Section_Guard const & ) = delete;
+
+  private:
+    /**
+     * \brief The PRIMASK register value when the critical section was entered.
+     */
+    std::uint32_t m_primask;
+};
+
 } // namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt
 
 #endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_H
@@ -0,0 +1,408 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Interrupt_Controller interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_CONTROLLER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_CONTROLLER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/nvic.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Interrupt number (IRQ 0-31).
+ */
+using Interrupt_Number = std::uint_fast8_t;
+
+/**
+ * \brief Interrupt priority.
+ *
+ * Arm Cortex-M0+ processors implement the 2 most significant bits of each priority field,
+ * and lower values are higher priorities.
+ */
+enum class Interrupt_Priority : std::uint8_t {
+    HIGHEST = 0 << 6, ///< Highest (0).
+    HIGH    = 1 << 6, ///< High (1).
+    LOW     = 2 << 6, ///< Low (2).
+    LOWEST  = 3 << 6, ///< Lowest (3).
+};
+
+/**
+ * \brief Interrupt configuration table entry.
+ */
+struct Interrupt_Configuration {
+    /**
+     * \brief The interrupt number.
+     */
+    Interrupt_Number interrupt;
+
+    /**
+     * \brief The interrupt's priority.
+     */
+    Interrupt_Priority priority;
+
+    /**
+     * \brief Enable the interrupt.
+     */
+    bool enable;
+};
+
+/**
+ * \brief NVIC peripheral register values for an interrupt configuration table, computed
+ *        at compile time.
+ */
+struct Interrupt_Controller_Configuration {
+    /**
+     * \brief The number of IPR registers.
+     */
+    static constexpr auto IPR_REGISTERS = std::size_t{ 8 };
+
+    /**
+     * \brief The configured IPR register priority fields.
+     */
+    std::uint32_t ipr[ IPR_REGISTERS ];
+
+    /**
+     * \brief The masks identifying the configured IPR register priority fields.
+     */
+    std::uint32_t ipr_mask[ IPR_REGISTERS ];
+
+    /**
+     * \brief The interrupts to enable.
+     */
+    std::uint32_t iser;
+
+    /**
+     * \brief The interrupts to disable.
+     */
+    std::uint32_t icer;
+};
+
+namespace Implementation {
+
+/**
+ * \brief Report an interrupt configuration table entry whose interrupt number is out of
+ *        range.
+ *
+ * This function is intentionally not constexpr: calling it makes the constant evaluation
+ * of picolibrary::Arm::Cortex::M0PLUS::make_interrupt_controller_configuration() fail.
+ */
+inline void interrupt_number_out_of_range() noexcept
+{
+}
+
+} // namespace Implementation
+
+/**
+ * \brief Compute the NVIC peripheral register values for an interrupt configuration
+ *        table.
+ *
+ * If an interrupt appears in the table more than once, the last entry is used. A table
+ * entry whose interrupt number is greater than 31 makes the constant evaluation of this
+ * function fail (entries that are out of range are ignored if this function is not
+ * constant evaluated).
+ *
+ * \tparam N The number of interrupt configuration table entries.
+ *
+ * \param[in] table The interrupt configuration table.
+ *
+ * \return The NVIC peripheral register values for the interrupt configuration table.
+ */
+template<std::size_t N>
+constexpr auto make_interrupt_controller_configuration( Interrupt_Configuration const ( &table )[ N ] ) noexcept
+    -> Interrupt_Controller_Configuration
+{
+    auto configuration = Interrupt_Controller_Configuration{};
+
+    for ( auto const & entry : table ) {
+        if ( entry.interrupt >= 32 ) {
+            Implementation::interrupt_number_out_of_range();
+            continue;
+        } // if
+
+        auto const word  = entry.interrupt / 4;
+        auto const shift = ( entry.interrupt % 4 ) * 8;
+
+        configuration.ipr[ word ] = ( configuration.ipr[ word ] & ~( std::uint32_t{ 0xFF } << shift ) )
+                                    | ( std::uint32_t{ to_underlying( entry.priority ) } << shift );
+        configuration.ipr_mask[ word ] |= std::uint32_t{ 0xFF } << shift;
+
+        if ( entry.enable ) {
+            configuration.iser |= std::uint32_t{ 1 } << entry.interrupt;
+            configuration.icer &= ~( std::uint32_t{ 1 } << entry.interrupt );
+        } else {
+            configuration.iser &= ~( std::uint32_t{ 1 } << entry.interrupt );
+            configuration.icer |= std::uint32_t{ 1 } << entry.interrupt;
+        } // else
+    }     // for
+
+    return configuration;
+}
+
+/**
+ * \brief Set the PENDSV exception's priority.
+ *
+ * \param[in] scb The SCB peripheral instance whose SHPR3 register should be written.
+ * \param[in] priority The PENDSV exception's priority.
+ */
+inline void set_pendsv_priority( Peripheral::SCB & scb, Interrupt_Priority priority ) noexcept
+{
+    // SHPR3 bits 23:16 hold the PENDSV exception's priority (PRI_14)
+    scb.shpr[ 1 ] = ( scb.shpr[ 1 ] & ~( std::uint32_t{ 0xFF } << 16 ) )
+                    | ( std::uint32_t{ to_underlying( priority ) } << 16 );
+}
+
+/**
+ * \brief NVIC driver.
+ *
+ * The Arm Cortex-M0+ NVIC peripheral's IPR registers only support word accesses, so
+ * changing a single interrupt's priority requires a read-modify-write of an IPR
+ * register. If SHADOW_PRIORITIES is true, the driver keeps a RAM copy of the IPR
+ * registers so that priority changes never read the IPR registers.
+ *
+ * \tparam SHADOW_PRIORITIES Keep a RAM copy of the IPR registers.
+ *
+ * \attention If SHADOW_PRIORITIES is true, the IPR registers must only be written through
+ *            the driver after it is constructed. Interrupt priorities are expected to be
+ *            configured from a single context (e.g. during initialization).
+ */
+template<bool SHADOW_PRIORITIES = false>
+class Interrupt_Controller {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] nvic The NVIC peripheral instance to use.
+     */
+    explicit Interrupt_Controller( Peripheral::NVIC & nvic ) noexcept : m_nvic{ &nvic }
+    {
+        if constexpr ( SHADOW_PRIORITIES ) {
+            for ( auto word = std::size_t{}; word < m_ipr.size(); ++word ) {
+                m_ipr[ word ] = m_nvic->ipr[ word ];
+            } // for
+        }     // if
+    }
+
+    Interrupt_Controller( Interrupt_Controller && ) = delete;
+
+    Interrupt_Controller( Interrupt_Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Interrupt_Controller() noexcept = default;
+
+    auto operator=( Interrupt_Controller && ) = delete;
+
+    auto operator=( Interrupt_Controller const & ) = delete;
+
+    /**
+     * \brief Enable an interrupt.
+     *
+     * \param[in] interrupt The interrupt to enable.
+     */
+    void enable( Interrupt_Number interrupt ) noexcept
+    {
+        m_nvic->iser = bit( interrupt );
+    }
+
+    /**
+     * \brief Disable an interrupt.
+     *
+     * \param[in] interrupt The interrupt to disable.
+     */
+    void disable( Interrupt_Number interrupt ) noexcept
+    {
+        m_nvic->icer = bit( interrupt );
+    }
+
+    /**
+     * \brief Check if an interrupt is enabled.
+     *
+     * \param[in] interrupt The interrupt to check.
+     *
+     * \return true if the interrupt is enabled.
+     * \return false if the interrupt is not enabled.
+     */
+    auto is_enabled( Interrupt_Number interrupt ) const noexcept -> bool
+    {
+        return m_nvic->iser & bit( interrupt );
+    }
+
+    /**
+     * \brief Pend an interrupt.
+     *
+     * \param[in] interrupt The interrupt to pend.
+     */
+    void pend( Interrupt_Number interrupt ) noexcept
+    {
+        m_nvic->ispr = bit( interrupt );
+    }
+
+    /**
+     * \brief Clear an interrupt's pending state.
+     *
+     * \param[in] interrupt The interrupt whose pending state should be cleared.
+     */
+    void unpend( Interrupt_Number interrupt ) noexcept
+    {
+        m_nvic->icpr = bit( interrupt );
+    }
+
+    /**
+     * \brief Check if an interrupt is pending.
+     *
+     * \param[in] interrupt The interrupt to check.
+     *
+     * \return true if the interrupt is pending.
+     * \return false if the interrupt is not pending.
+     */
+    auto is_pending( Interrupt_Number interrupt ) const noexcept -> bool
+    {
+        return m_nvic->ispr & bit( interrupt );
+    }
+
+    /**
+     * \brief Set an interrupt's priority.
+     *
+     * \param[in] interrupt The interrupt whose priority should be set.
+     * \param[in] priority The interrupt's priority.
+     */
+    void set_priority( Interrupt_Number interrupt, Interrupt_Priority priority ) noexcept
+    {
+        auto const shift = ( interrupt % 4 ) * 8;
+
+        write_ipr(
+            interrupt / 4,
+            std::uint32_t{ to_underlying( priority ) } << shift,
+            std::uint32_t{ 0xFF } << shift );
+    }
+
+    /**
+     * \brief Get an interrupt's priority.
+     *
+     * \param[in] interrupt The interrupt whose priority should be gotten.
+     *
+     * \return The interrupt's priority.
+     */
+    auto priority( Interrupt_Number interrupt ) const noexcept -> Interrupt_Priority
+    {
+        return static_cast<Interrupt_Priority>( ( read_ipr( interrupt / 4 ) >> ( ( interrupt % 4 ) * 8 ) ) & 0xC0 );
+    }
+
+    /**
+     * \brief Apply an interrupt configuration table.
+     *
+     * The interrupts to disable are disabled with a single ICER write, each IPR register
+     * that holds a configured priority field is written once (IPR registers whose priority
+     * fields are all configured are written without being read, and no IPR register is
+     * read if SHADOW_PRIORITIES is true), and the interrupts to enable are enabled with a
+     * single ISER write.
+     *
+     * \param[in] configuration The NVIC peripheral register values for the interrupt
+     *            configuration table (see
+     *            picolibrary::Arm::Cortex::M0PLUS::make_interrupt_controller_configuration()).
+     */
+    void configure( Interrupt_Controller_Configuration const & configuration ) noexcept
+    {
+        if ( configuration.icer ) {
+            m_nvic->icer = configuration.icer;
+        } // if
+
+        for ( auto word = std::size_t{}; word < Interrupt_Controller_Configuration::IPR_REGISTERS; ++word ) {
+            if ( configuration.ipr_mask[ word ] ) {
+                write_ipr( word, configuration.ipr[ word ], configuration.ipr_mask[ word ] );
+            } // if
+        }     // for
+
+        if ( configuration.iser ) {
+            m_nvic->iser = configuration.iser;
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The NVIC peripheral instance.
+     */
+    Peripheral::NVIC * m_nvic;
+
+    /**
+     * \brief The RAM copy of the IPR registers (empty if SHADOW_PRIORITIES is false).
+     */
+    std::array<std::uint32_t, SHADOW_PRIORITIES ? Interrupt_Controller_Configuration::IPR_REGISTERS : 0> m_ipr{};
+
+    /**
+     * \brief Get an interrupt's ISER/ICER/ISPR/ICPR register bit.
+     *
+     * \param[in] interrupt The interrupt.
+     *
+     * \return The interrupt's ISER/ICER/ISPR/ICPR register bit.
+     */
+    static constexpr auto bit( Interrupt_Number interrupt ) noexcept -> std::uint32_t
+    {
+        return std::uint32_t{ 1 } << interrupt;
+    }
+
+    /**
+     * \brief Read an IPR register.
+     *
+     * \param[in] word The IPR register to read.
+     *
+     * \return The IPR register value.
+     */
+    auto read_ipr( std::size_t word ) const noexcept -> std::uint32_t
+    {
+        if constexpr ( SHADOW_PRIORITIES ) {
+            return m_ipr[ word ];
+        } else {
+            return m_nvic->ipr[ word ];
+        } // else
+    }
+
+    /**
+     * \brief Write priority fields to an IPR register.
+     *
+     * \param[in] word The IPR register to write.
+     * \param[in] value The priority fields to write.
+     * \param[in] mask The mask identifying the priority fields to write.
+     */
+    void write_ipr( std::size_t word, std::uint32_t value, std::uint32_t mask ) noexcept
+    {
+        auto const ipr = mask == ~std::uint32_t{} ? value : ( read_ipr( word ) & ~mask ) | value;
+
+        if constexpr ( SHADOW_PRIORITIES ) {
+            m_ipr[ word ] = ipr;
+        } // if
+
+        m_nvic->ipr[ word ] = ipr;
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTERRUPT_CONTROLLER_H
@@ -0,0 +1,319 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS intrinsics interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_H
+
+#include <atomic>
+#include <cstdint>
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+#if defined( __arm__ )
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED 0
+#else // defined( __arm__ )
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED 1
+#endif // defined( __arm__ )
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+/**
+ * \brief Emulated core registers.
+ *
+ * When the intrinsics are emulated (i.e. when compiling for a host for unit testing), the
+ * core register intrinsics read and write these values instead of the core registers.
+ */
+struct Emulated_Core_Registers {
+    /**
+     * \brief PRIMASK.
+     */
+    std::uint32_t primask;
+
+    /**
+     * \brief CONTROL.
+     */
+    std::uint32_t control;
+
+    /**
+     * \brief PSP.
+     */
+    std::uint32_t psp;
+
+    /**
+     * \brief MSP.
+     */
+    std::uint32_t msp;
+};
+
+/**
+ * \brief The emulated core registers.
+ */
+inline Emulated_Core_Registers emulated_core_registers{};
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+
+/**
+ * \brief Disable interrupts (CPSID I).
+ */
+inline void disable_interrupts() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.primask = 1;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "cpsid i" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Enable interrupts (CPSIE I).
+ */
+inline void enable_interrupts() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.primask = 0;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "cpsie i" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Read the PRIMASK register (MRS PRIMASK).
+ *
+ * \return The PRIMASK register value.
+ */
+inline auto read_primask() noexcept -> std::uint32_t
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    return emulated_core_registers.primask;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::uint32_t primask;
+
+    asm volatile( "mrs %[primask], primask" : [primask] "=r"( primask ) : : "memory" );
+
+    return primask;
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Write the PRIMASK register (MSR PRIMASK).
+ *
+ * \param[in] primask The PRIMASK register value to write.
+ */
+inline void write_primask( std::uint32_t primask ) noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.primask = primask;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "msr primask, %[primask]" : : [primask] "r"( primask ) : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Read the CONTROL register (MRS CONTROL).
+ *
+ * \return The CONTROL register value.
+ */
+inline auto read_control() noexcept -> std::uint32_t
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    return emulated_core_registers.control;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::uint32_t control;
+
+    asm volatile( "mrs %[control], control" : [control] "=r"( control ) : : "memory" );
+
+    return control;
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Write the CONTROL register (MSR CONTROL).
+ *
+ * The write is followed by an ISB so that subsequent instructions use the new stack
+ * pointer selection and privilege level.
+ *
+ * \param[in] control The CONTROL register value to write.
+ */
+inline void write_control( std::uint32_t control ) noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.control = control;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "msr control, %[control] \n\t"
+                  "isb                 \n\t"
+                  :
+                  : [control] "r"( control )
+                  : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Read the PSP register (MRS PSP).
+ *
+ * \return The PSP register value.
+ */
+inline auto read_psp() noexcept -> std::uint32_t
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    return emulated_core_registers.psp;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::uint32_t psp;
+
+    asm volatile( "mrs %[psp], psp" : [psp] "=r"( psp ) : : "memory" );
+
+    return psp;
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Write the PSP register (MSR PSP).
+ *
+ * \param[in] psp The PSP register value to write.
+ */
+inline void write_psp( std::uint32_t psp ) noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.psp = psp;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "msr psp, %[psp]" : : [psp] "r"( psp ) : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Read the MSP register (MRS MSP).
+ *
+ * \return The MSP register value.
+ */
+inline auto read_msp() noexcept -> std::uint32_t
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    return emulated_core_registers.msp;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::uint32_t msp;
+
+    asm volatile( "mrs %[msp], msp" : [msp] "=r"( msp ) : : "memory" );
+
+    return msp;
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Write the MSP register (MSR MSP).
+ *
+ * \param[in] msp The MSP register value to write.
+ */
+inline void write_msp( std::uint32_t msp ) noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    emulated_core_registers.msp = msp;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "msr msp, %[msp]" : : [msp] "r"( msp ) : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Wait for interrupt (WFI).
+ */
+inline void wait_for_interrupt() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // no effect on the host
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "wfi" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Wait for event (WFE).
+ */
+inline void wait_for_event() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // no effect on the host
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "wfe" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Send event (SEV).
+ */
+inline void send_event() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // no effect on the host
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "sev" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Supervisor call (SVC #0).
+ */
+inline void supervisor_call() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // no effect on the host
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "svc 0" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Data memory barrier (DMB).
+ */
+inline void data_memory_barrier() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "dmb" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Data synchronization barrier (DSB).
+ */
+inline void data_synchronization_barrier() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "dsb" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+/**
+ * \brief Instruction synchronization barrier (ISB).
+ */
+inline void instruction_synchronization_barrier() noexcept
+{
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    std::atomic_signal_fence( std::memory_order_seq_cst );
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile( "isb" : : : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_H
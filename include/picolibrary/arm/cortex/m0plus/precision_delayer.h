@@ -0,0 +1,153 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Precision_Delayer interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_PRECISION_DELAYER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_PRECISION_DELAYER_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Blocking delayer that measures delays by reading the SYSTICK peripheral's
+ *        current counter value.
+ *
+ * The delayer does not configure the SYSTICK peripheral. It shares a SYSTICK peripheral
+ * counter that is already running (e.g. a periodic tick) with its owner, and never
+ * writes to the SYSTICK peripheral's registers.
+ *
+ * \attention The SYSTICK peripheral counter period must be longer than one iteration of
+ *            the delay loop (a few tens of cycles). Delays are minimums: if the delay is
+ *            interrupted for longer than a SYSTICK peripheral counter period, the delay
+ *            will be extended.
+ */
+class Precision_Delayer {
+  public:
+    /**
+     * \brief Convert a duration to a number of SYSTICK peripheral counter clock cycles.
+     *
+     * \tparam CLOCK_FREQUENCY The SYSTICK peripheral counter clock frequency (Hz).
+     * \tparam Rep The duration's representation.
+     * \tparam Period The duration's period.
+     *
+     * \param[in] duration The duration to convert.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles in the duration,
+     *         rounded to the nearest cycle.
+     */
+    template<std::uint32_t CLOCK_FREQUENCY, typename Rep, typename Period>
+    static constexpr auto cycles( std::chrono::duration<Rep, Period> duration ) noexcept -> std::uint32_t
+    {
+        return ( std::uintmax_t{ CLOCK_FREQUENCY } * static_cast<std::uintmax_t>( duration.count() ) * Period::num
+                 + Period::den / 2 )
+               / Period::den;
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Precision_Delayer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The running SYSTICK peripheral instance to use to measure
+     *            delays.
+     */
+    constexpr explicit Precision_Delayer( Peripheral::SYSTICK & systick ) noexcept :
+        m_systick{ &systick }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Precision_Delayer( Precision_Delayer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Precision_Delayer( Precision_Delayer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Precision_Delayer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Precision_Delayer && expression ) noexcept -> Precision_Delayer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Precision_Delayer const & expression ) noexcept
+        -> Precision_Delayer & = default;
+
+    /**
+     * \brief Delay.
+     *
+     * \param[in] cycles The number of SYSTICK peripheral counter clock cycles to delay
+     *            for.
+     */
+    void operator()( std::uint32_t cycles ) const noexcept
+    {
+        auto previous = static_cast<std::uint32_t>( m_systick->cvr );
+        auto elapsed  = std::uint32_t{};
+
+        while ( elapsed < cycles ) {
+            auto const current = static_cast<std::uint32_t>( m_systick->cvr );
+
+            // the counter counts down, and is reloaded from RVR after reaching 0
+            elapsed += current <= previous ? previous - current
+                                           : previous + ( m_systick->rvr + 1 ) - current;
+
+            previous = current;
+        } // while
+    }
+
+  private:
+    /**
+     * \brief The SYSTICK peripheral instance used to measure delays.
+     */
+    Peripheral::SYSTICK * m_systick{};
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_PRECISION_DELAYER_H
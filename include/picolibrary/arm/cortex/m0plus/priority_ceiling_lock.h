@@ -0,0 +1,150 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Priority_Ceiling_Lock interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_PRIORITY_CEILING_LOCK_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_PRIORITY_CEILING_LOCK_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/nvic.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Compute the set of interrupts a priority ceiling lock masks.
+ *
+ * An interrupt is masked if its priority is configured, and its priority is the ceiling
+ * priority or a lower priority.
+ *
+ * \param[in] configuration The NVIC peripheral register values for the interrupt
+ *            configuration table (see
+ *            picolibrary::Arm::Cortex::M0PLUS::make_interrupt_controller_configuration()).
+ * \param[in] ceiling The ceiling priority (the highest priority of the interrupts that
+ *            access the resource the lock protects).
+ *
+ * \return The ISER/ICER register bits of the interrupts the lock masks.
+ */
+constexpr auto make_priority_ceiling_mask( Interrupt_Controller_Configuration const & configuration, Interrupt_Priority ceiling ) noexcept
+    -> std::uint32_t
+{
+    auto mask = std::uint32_t{};
+
+    for ( auto interrupt = std::size_t{}; interrupt < Interrupt_Controller_Configuration::IPR_REGISTERS * 4; ++interrupt ) {
+        auto const word  = interrupt / 4;
+        auto const shift = ( interrupt % 4 ) * 8;
+
+        if ( ( configuration.ipr_mask[ word ] >> shift ) & 0xFF ) {
+            if ( ( ( configuration.ipr[ word ] >> shift ) & 0xC0 ) >= to_underlying( ceiling ) ) {
+                mask |= std::uint32_t{ 1 } << interrupt;
+            } // if
+        }     // if
+    }         // for
+
+    return mask;
+}
+
+/**
+ * \brief Priority ceiling lock (Stack Resource Policy) RAII guard.
+ *
+ * Arm Cortex-M0+ processors do not implement the BASEPRI register, so a priority ceiling
+ * is emulated by disabling, in the NVIC peripheral, the interrupts at or below the ceiling
+ * priority. Interrupts above the ceiling priority are never blocked, so their latency is
+ * unaffected by the lock. Only the interrupts that were enabled when the lock was
+ * acquired are re-enabled when the lock is released, so locks can be nested.
+ *
+ * \tparam MASK The ISER/ICER register bits of the interrupts the lock masks (see
+ *         picolibrary::Arm::Cortex::M0PLUS::make_priority_ceiling_mask()).
+ *
+ * \attention The interrupts the lock masks must not be enabled or disabled by other code
+ *            while the lock is held, and the lock must not be used to protect a resource
+ *            accessed by an exception whose enable is not controlled by the NVIC
+ *            peripheral (e.g. SysTick or PendSV), use a
+ *            picolibrary::Arm::Cortex::M0PLUS::Interrupt::Critical_Section_Guard
+ *            instead.
+ */
+template<std::uint32_t MASK>
+class Priority_Ceiling_Lock {
+  public:
+    /**
+     * \brief The ISER/ICER register bits of the interrupts the lock masks.
+     */
+    static constexpr auto INTERRUPTS = MASK;
+
+    Priority_Ceiling_Lock() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * Masks the interrupts at or below the ceiling priority. A DSB and an ISB guarantee
+     * that none of the masked interrupts are taken after the constructor returns.
+     *
+     * \param[in] nvic The NVIC peripheral instance to use.
+     */
+    explicit Priority_Ceiling_Lock( Peripheral::NVIC & nvic ) noexcept :
+        m_nvic{ &nvic },
+        m_iser{ nvic.iser & MASK }
+    {
+        m_nvic->icer = MASK;
+
+        data_synchronization_barrier();
+        instruction_synchronization_barrier();
+    }
+
+    Priority_Ceiling_Lock( Priority_Ceiling_Lock && ) = delete;
+
+    Priority_Ceiling_Lock( Priority_Ceiling_Lock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * Re-enables the masked interrupts that were enabled when the lock was acquired.
+     */
+    ~Priority_Ceiling_Lock() noexcept
+    {
+        if ( m_iser ) {
+            m_nvic->iser = m_iser;
+        } // if
+    }
+
+    auto operator=( Priority_Ceiling_Lock && ) = delete;
+
+    auto operator=( Priority_Ceiling_Lock const & ) = delete;
+
+  private:
+    /**
+     * \brief The NVIC peripheral instance.
+     */
+    Peripheral::NVIC * m_nvic;
+
+    /**
+     * \brief The masked interrupts that were enabled when the lock was acquired.
+     */
+    std::uint32_t m_iser;
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_PRIORITY_CEILING_LOCK_H
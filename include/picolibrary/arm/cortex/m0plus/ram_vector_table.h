@@ -0,0 +1,148 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Interrupt::RAM_Vector_Table interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_RAM_VECTOR_TABLE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_RAM_VECTOR_TABLE_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SCB_VTOR
+/**
+ * \brief RAM interrupt vector table.
+ *
+ * A RAM vector table is a copy of a (flash) interrupt vector table that the SCB
+ * peripheral's VTOR register is pointed at, which allows interrupt handlers to be swapped
+ * at run time with a single store instead of through an indirect call inside every
+ * handler.
+ *
+ * \attention A RAM vector table must have static storage duration, and must not be
+ *            destroyed while it is active.
+ */
+class RAM_Vector_Table {
+  public:
+    /**
+     * \brief Vector table entry.
+     */
+    using Vector = Handler Vector_Table::*;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr RAM_Vector_Table() noexcept = default;
+
+    RAM_Vector_Table( RAM_Vector_Table && ) = delete;
+
+    RAM_Vector_Table( RAM_Vector_Table const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~RAM_Vector_Table() noexcept = default;
+
+    auto operator=( RAM_Vector_Table && ) = delete;
+
+    auto operator=( RAM_Vector_Table const & ) = delete;
+
+    /**
+     * \brief Copy an interrupt vector table into the RAM vector table, and point the SCB
+     *        peripheral's VTOR register at the RAM vector table.
+     *
+     * Interrupts are disabled while the interrupt vector table is copied and the VTOR
+     * register is written, so no exception is taken using a partially copied table.
+     *
+     * \param[in] scb The SCB peripheral instance whose VTOR register should be written.
+     * \param[in] vector_table The interrupt vector table to copy.
+     */
+    void activate( Peripheral::SCB & scb, Vector_Table const & vector_table ) noexcept
+    {
+        Critical_Section_Guard const guard;
+
+        m_vector_table = vector_table;
+
+        data_synchronization_barrier();
+
+        scb.vtor = static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( &m_vector_table ) );
+
+        data_synchronization_barrier();
+        instruction_synchronization_barrier();
+    }
+
+    /**
+     * \brief Get the RAM vector table's contents.
+     *
+     * \return The RAM vector table's contents.
+     */
+    constexpr auto vector_table() const noexcept -> Vector_Table const &
+    {
+        return m_vector_table;
+    }
+
+    /**
+     * \brief Get a vector table entry's handler.
+     *
+     * \param[in] vector The vector table entry (e.g.
+     *            &picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table::pendsv_handler).
+     *
+     * \return The vector table entry's handler.
+     */
+    constexpr auto handler( Vector vector ) const noexcept -> Handler
+    {
+        return m_vector_table.*vector;
+    }
+
+    /**
+     * \brief Set a vector table entry's handler.
+     *
+     * The handler is swapped with a single store, so this can be called while the RAM
+     * vector table is active and the interrupt is enabled. A DSB guarantees that the next
+     * exception entry uses the new handler.
+     *
+     * \param[in] vector The vector table entry (e.g.
+     *            &picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table::pendsv_handler).
+     * \param[in] new_handler The vector table entry's new handler.
+     */
+    void set_handler( Vector vector, Handler new_handler ) noexcept
+    {
+        m_vector_table.*vector = new_handler;
+
+        data_synchronization_barrier();
+    }
+
+  private:
+    /**
+     * \brief The RAM vector table's contents (Vector_Table's alignment satisfies the VTOR
+     *        register's alignment requirement).
+     */
+    Vector_Table m_vector_table{};
+};
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SCB_VTOR
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_RAM_VECTOR_TABLE_H
@@ -0,0 +1,166 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Seqlock interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SEQLOCK_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SEQLOCK_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Sequence lock.
+ *
+ * A sequence lock publishes a multi-word value from a writer that never blocks (e.g. an
+ * interrupt handler) to readers that never disable interrupts (e.g. thread mode). The
+ * writer makes the sequence number odd, writes the value, and makes the sequence number
+ * even again. A reader reads the sequence number, copies the value, and reads the
+ * sequence number again, retrying if the sequence number was odd or changed (the copy
+ * was torn by a write). Only aligned word stores and DMB instructions are used, both of
+ * which Arm Cortex-M0+ processors support.
+ *
+ * \tparam T The value type (must be trivially copyable).
+ *
+ * \attention Only one context may write. Readers must not preempt the writer (a reader
+ *            that preempts a write in progress would retry forever), so values must only
+ *            be read from contexts whose priority is lower than the writer's.
+ */
+template<typename T>
+class Seqlock {
+  public:
+    static_assert( std::is_trivially_copyable_v<T>, "T must be trivially copyable" );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Seqlock() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] value The initial value.
+     */
+    constexpr explicit Seqlock( T const & value ) noexcept : m_value{ value }
+    {
+    }
+
+    Seqlock( Seqlock && ) = delete;
+
+    Seqlock( Seqlock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Seqlock() noexcept = default;
+
+    auto operator=( Seqlock && ) = delete;
+
+    auto operator=( Seqlock const & ) = delete;
+
+    /**
+     * \brief Get the sequence number.
+     *
+     * \return The sequence number (odd while a write is in progress, incremented by 2 by
+     *         each write).
+     */
+    auto sequence() const noexcept -> std::uint32_t
+    {
+        return m_sequence;
+    }
+
+    /**
+     * \brief Write the value (writer).
+     *
+     * \param[in] value The new value.
+     */
+    void write( T const & value ) noexcept
+    {
+        auto const sequence = m_sequence;
+
+        m_sequence = sequence + 1;
+
+        // the odd sequence number must be observed before any of the value writes
+        data_memory_barrier();
+
+        m_value = value;
+
+        // the value writes must be observed before the even sequence number
+        data_memory_barrier();
+
+        m_sequence = sequence + 2;
+    }
+
+    /**
+     * \brief Attempt to read the value (reader).
+     *
+     * \param[out] value The value (only valid if the read was not torn).
+     *
+     * \return true if the read was not torn by a write.
+     * \return false if the read was torn by a write.
+     */
+    auto try_read( T & value ) const noexcept -> bool
+    {
+        auto const sequence = m_sequence;
+
+        // the sequence number read must complete before any of the value reads
+        data_memory_barrier();
+
+        value = m_value;
+
+        // the value reads must complete before the sequence number is read again
+        data_memory_barrier();
+
+        return not( sequence & 1 ) and m_sequence == sequence;
+    }
+
+    /**
+     * \brief Read the value (reader), retrying until the read is not torn by a write.
+     *
+     * \return The value.
+     */
+    auto read() const noexcept -> T
+    {
+        auto value = T{};
+
+        while ( not try_read( value ) ) {} // while
+
+        return value;
+    }
+
+  private:
+    /**
+     * \brief The sequence number.
+     */
+    std::uint32_t volatile m_sequence{};
+
+    /**
+     * \brief The value.
+     */
+    T m_value{};
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SEQLOCK_H
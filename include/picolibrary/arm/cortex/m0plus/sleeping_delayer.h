@@ -0,0 +1,220 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Sleeping_Delayer interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SLEEPING_DELAYER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SLEEPING_DELAYER_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/delay_configuration.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/systick_calibration.h"
+#include "picolibrary/arm/cortex/m0plus/systick_clock_source.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Blocking delayer that sleeps (WFI) between SYSTICK peripheral counter reloads
+ *        instead of polling the SYSTICK peripheral's COUNTFLAG.
+ *
+ * The SYSTICK peripheral counter only runs while a delay is in progress. Interrupts
+ * other than the SYSTICK interrupt are serviced normally while a delay is in progress.
+ *
+ * \attention The SYSTICK interrupt handler must call
+ *            picolibrary::Arm::Cortex::M0PLUS::Sleeping_Delayer::handle_interrupt().
+ *
+ * \attention The SCB peripheral's SCR register's SLEEPDEEP bit must be clear unless the
+ *            SYSTICK peripheral counter clock keeps running in deep sleep.
+ */
+class Sleeping_Delayer {
+  public:
+    /**
+     * \brief SYSTICK clock source.
+     */
+    using Clock_Source = SYSTICK_Clock_Source;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to create blocking
+     *            delays.
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use to
+     *            create blocking delays of the desired duration.
+     * \param[in] ticks The number of SYSTICK peripheral counter reloads required to
+     *            create blocking delays of the desired duration.
+     *
+     * \attention The delayer will use the processor clock if the external reference clock
+     *            is requested but is not available.
+     */
+    Sleeping_Delayer( Peripheral::SYSTICK & systick, Clock_Source clock_source, std::uint32_t reload_value, std::uint32_t ticks ) noexcept
+        :
+        m_systick{ &systick },
+        m_clock_source{ clock_source },
+        m_ticks{ ticks }
+    {
+        m_systick->csr = to_underlying( m_clock_source );
+        m_systick->rvr = reload_value;
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam CLOCK_FREQUENCY The SYSTICK peripheral counter clock frequency (Hz).
+     * \tparam Duration The std::chrono::duration specialization used to express the
+     *         delay duration.
+     * \tparam DURATION The delay duration.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to create blocking
+     *            delays.
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] configuration The compile time SYSTICK peripheral counter configuration
+     *            for blocking delays of the desired duration.
+     *
+     * \attention The delayer will use the processor clock if the external reference clock
+     *            is requested but is not available.
+     */
+    template<std::uint32_t CLOCK_FREQUENCY, typename Duration, typename Duration::rep DURATION>
+    Sleeping_Delayer( Peripheral::SYSTICK & systick, Clock_Source clock_source, Delay_Configuration<CLOCK_FREQUENCY, Duration, DURATION> configuration ) noexcept
+        :
+        Sleeping_Delayer{ systick, clock_source, configuration.reload_value(), configuration.ticks() }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to create blocking
+     *            delays.
+     * \param[in] configuration The run time SYSTICK peripheral counter configuration for
+     *            blocking delays of the desired duration (see
+     *            picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Calibration::configure()).
+     */
+    Sleeping_Delayer( Peripheral::SYSTICK & systick, SYSTICK_Counter_Configuration const & configuration ) noexcept
+        :
+        Sleeping_Delayer{ systick, configuration.clock_source, configuration.reload_value, configuration.ticks }
+    {
+    }
+
+    Sleeping_Delayer( Sleeping_Delayer && ) = delete;
+
+    Sleeping_Delayer( Sleeping_Delayer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Sleeping_Delayer() noexcept
+    {
+        m_systick->rvr = 0;
+        m_systick->csr = 0;
+    }
+
+    auto operator=( Sleeping_Delayer && ) = delete;
+
+    auto operator=( Sleeping_Delayer const & ) = delete;
+
+    /**
+     * \brief Change the delay configuration (e.g. after the processor clock frequency
+     *        changes) without reconstructing the delayer.
+     *
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use to
+     *            create blocking delays of the desired duration.
+     * \param[in] ticks The number of SYSTICK peripheral counter reloads required to
+     *            create blocking delays of the desired duration.
+     *
+     * \attention This function must not be called while a delay is in progress.
+     */
+    void reconfigure( Clock_Source clock_source, std::uint32_t reload_value, std::uint32_t ticks ) noexcept
+    {
+        m_clock_source = clock_source;
+        m_ticks        = ticks;
+
+        m_systick->csr = to_underlying( m_clock_source );
+        m_systick->rvr = reload_value;
+    }
+
+    /**
+     * \brief Delay.
+     *
+     * \attention Interrupts must be enabled when this function is called.
+     */
+    void operator()() noexcept
+    {
+        m_reloads = 0;
+
+        m_systick->cvr = 0;
+        m_systick->csr = to_underlying( m_clock_source ) | Peripheral::SYSTICK::CSR::Mask::TICKINT
+                         | Peripheral::SYSTICK::CSR::Mask::ENABLE;
+
+        // interrupts are disabled while checking the reload count so that a SYSTICK
+        // interrupt cannot be handled between the check and the WFI, WFI still wakes on
+        // the pending interrupt, which is then handled once interrupts are re-enabled
+        auto const primask = read_primask();
+        disable_interrupts();
+        while ( m_reloads < m_ticks ) {
+            wait_for_interrupt();
+            enable_interrupts();
+            disable_interrupts();
+        } // while
+
+        m_systick->csr = to_underlying( m_clock_source );
+        write_primask( primask );
+    }
+
+    /**
+     * \brief Handle a SYSTICK interrupt.
+     */
+    void handle_interrupt() noexcept
+    {
+        m_reloads = m_reloads + 1;
+    }
+
+  private:
+    /**
+     * \brief The SYSTICK peripheral instance used to create blocking delays.
+     */
+    Peripheral::SYSTICK * m_systick;
+
+    /**
+     * \brief The SYSTICK peripheral clock source.
+     */
+    Clock_Source m_clock_source;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter reloads required to create blocking
+     *        delays of the desired duration.
+     */
+    std::uint32_t m_ticks;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter reloads that have occurred during
+     *        the delay that is in progress.
+     */
+    std::uint32_t volatile m_reloads{};
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SLEEPING_DELAYER_H
@@ -0,0 +1,141 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Software_Interrupt interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SOFTWARE_INTERRUPT_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SOFTWARE_INTERRUPT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/nvic.h"
+#include "picolibrary/arm/cortex/m0plus/work_queue.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Software interrupt task dispatcher.
+ *
+ * A software interrupt claims an interrupt that is not used by any peripheral, and uses
+ * it to run queued work items (run-to-completion tasks) at the interrupt's priority.
+ * Posting a work item pends the interrupt through the NVIC peripheral's ISPR register, so
+ * the NVIC peripheral schedules and preempts the work items of software interrupts with
+ * different priorities without any scheduler code.
+ *
+ * \tparam CAPACITY The maximum number of queued work items.
+ *
+ * \attention The claimed interrupt must not be used by any peripheral, and
+ *            picolibrary::Arm::Cortex::M0PLUS::Software_Interrupt::handle_interrupt()
+ *            must be called by the claimed interrupt's handler (e.g. using
+ *            picolibrary::Arm::Cortex::M0PLUS::Interrupt::member_handler()).
+ */
+template<std::size_t CAPACITY>
+class Software_Interrupt {
+  public:
+    /**
+     * \brief Work function.
+     */
+    using Work = typename Work_Queue<CAPACITY>::Work;
+
+    Software_Interrupt() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * Sets the claimed interrupt's priority, and enables the claimed interrupt.
+     *
+     * \param[in] nvic The NVIC peripheral instance to use.
+     * \param[in] interrupt The claimed interrupt.
+     * \param[in] priority The claimed interrupt's priority.
+     */
+    Software_Interrupt( Peripheral::NVIC & nvic, Interrupt_Number interrupt, Interrupt_Priority priority ) noexcept :
+        m_nvic{ &nvic },
+        m_mask{ std::uint32_t{ 1 } << interrupt }
+    {
+        Interrupt_Controller<> interrupt_controller{ nvic };
+
+        interrupt_controller.set_priority( interrupt, priority );
+        interrupt_controller.enable( interrupt );
+    }
+
+    Software_Interrupt( Software_Interrupt && ) = delete;
+
+    Software_Interrupt( Software_Interrupt const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Software_Interrupt() noexcept = default;
+
+    auto operator=( Software_Interrupt && ) = delete;
+
+    auto operator=( Software_Interrupt const & ) = delete;
+
+    /**
+     * \brief Queue a work item and pend the claimed interrupt.
+     *
+     * \param[in] work The work function.
+     * \param[in] context The context to pass to the work function.
+     *
+     * \return true if the work item was queued.
+     * \return false if the queue is full.
+     */
+    auto post( Work work, void * context ) noexcept -> bool
+    {
+        if ( not m_queue.push( work, context ) ) {
+            return false;
+        } // if
+
+        m_nvic->ispr = m_mask;
+
+        return true;
+    }
+
+    /**
+     * \brief Handle the claimed interrupt (run queued work items until the queue is
+     *        empty).
+     */
+    void handle_interrupt() noexcept
+    {
+        m_queue.drain();
+    }
+
+  private:
+    /**
+     * \brief The NVIC peripheral instance.
+     */
+    Peripheral::NVIC * m_nvic;
+
+    /**
+     * \brief The claimed interrupt's ISER/ICER/ISPR/ICPR register bit.
+     */
+    std::uint32_t m_mask;
+
+    /**
+     * \brief The work queue.
+     */
+    Work_Queue<CAPACITY> m_queue{};
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SOFTWARE_INTERRUPT_H
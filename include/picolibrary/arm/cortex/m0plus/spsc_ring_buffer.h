@@ -0,0 +1,337 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SPSC_RING_BUFFER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SPSC_RING_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Single producer, single consumer ring buffer.
+ *
+ * The producer and the consumer may run in different contexts (e.g. an interrupt handler
+ * and thread mode) without critical sections. Arm Cortex-M0+ processors do not implement
+ * exclusive loads and stores, so the read and write positions are free running words that
+ * are each written by only one side using aligned word stores, and DMB instructions order
+ * the element accesses relative to the position updates.
+ *
+ * \tparam T The element type (must be trivially copyable).
+ * \tparam CAPACITY The maximum number of elements (must be a power of 2).
+ *
+ * \attention Only one context may push (including through
+ *            picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::write_region()), and only
+ *            one context may pop (including through
+ *            picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::read_region()).
+ */
+template<typename T, std::size_t CAPACITY>
+class SPSC_Ring_Buffer {
+  public:
+    static_assert( std::is_trivially_copyable_v<T>, "T must be trivially copyable" );
+
+    static_assert(
+        CAPACITY > 0 and ( CAPACITY & ( CAPACITY - 1 ) ) == 0 and CAPACITY <= ( std::uint32_t{ 1 } << 31 ),
+        "CAPACITY must be a power of 2" );
+
+    /**
+     * \brief Contiguous ring buffer region.
+     *
+     * \tparam Element The region's element type.
+     */
+    template<typename Element>
+    struct Region {
+        /**
+         * \brief The region's first element.
+         */
+        Element * data;
+
+        /**
+         * \brief The number of elements in the region.
+         */
+        std::size_t size;
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr SPSC_Ring_Buffer() noexcept = default;
+
+    SPSC_Ring_Buffer( SPSC_Ring_Buffer && ) = delete;
+
+    SPSC_Ring_Buffer( SPSC_Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~SPSC_Ring_Buffer() noexcept = default;
+
+    auto operator=( SPSC_Ring_Buffer && ) = delete;
+
+    auto operator=( SPSC_Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the maximum number of elements.
+     *
+     * \return The maximum number of elements.
+     */
+    static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * \brief Get the number of elements in the ring buffer.
+     *
+     * \return The number of elements in the ring buffer (exact when called by the producer
+     *         or the consumer, otherwise a snapshot).
+     */
+    auto size() const noexcept -> std::size_t
+    {
+        return m_write - m_read;
+    }
+
+    /**
+     * \brief Check if the ring buffer is empty.
+     *
+     * \return true if the ring buffer is empty.
+     * \return false if the ring buffer is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return m_write == m_read;
+    }
+
+    /**
+     * \brief Check if the ring buffer is full.
+     *
+     * \return true if the ring buffer is full.
+     * \return false if the ring buffer is not full.
+     */
+    auto full() const noexcept -> bool
+    {
+        return size() == CAPACITY;
+    }
+
+    /**
+     * \brief Push an element (producer).
+     *
+     * \param[in] value The element to push.
+     *
+     * \return true if the element was pushed.
+     * \return false if the ring buffer is full.
+     */
+    auto push( T const & value ) noexcept -> bool
+    {
+        return push( &value, 1 );
+    }
+
+    /**
+     * \brief Push elements (producer).
+     *
+     * \param[in] values The elements to push.
+     * \param[in] count The number of elements to push.
+     *
+     * \return The number of elements that were pushed (limited by the free space).
+     */
+    auto push( T const * values, std::size_t count ) noexcept -> std::size_t
+    {
+        auto const write = m_write;
+        auto const free  = CAPACITY - ( write - m_read );
+
+        if ( count > free ) {
+            count = free;
+        } // if
+
+        // the consumer must be done reading the free elements before they are written
+        data_memory_barrier();
+
+        for ( auto i = std::size_t{}; i < count; ++i ) {
+            m_elements[ ( write + i ) & MASK ] = values[ i ];
+        } // for
+
+        publish_write( write + count );
+
+        return count;
+    }
+
+    /**
+     * \brief Pop an element (consumer).
+     *
+     * \param[out] value The popped element.
+     *
+     * \return true if an element was popped.
+     * \return false if the ring buffer is empty.
+     */
+    auto pop( T & value ) noexcept -> bool
+    {
+        return pop( &value, 1 );
+    }
+
+    /**
+     * \brief Pop elements (consumer).
+     *
+     * \param[out] values The popped elements.
+     * \param[in] count The maximum number of elements to pop.
+     *
+     * \return The number of elements that were popped (limited by the number of elements
+     *         in the ring buffer).
+     */
+    auto pop( T * values, std::size_t count ) noexcept -> std::size_t
+    {
+        auto const read      = m_read;
+        auto const available = m_write - read;
+
+        if ( count > available ) {
+            count = available;
+        } // if
+
+        // the producer's element writes must be observed before the elements are read
+        data_memory_barrier();
+
+        for ( auto i = std::size_t{}; i < count; ++i ) {
+            values[ i ] = m_elements[ ( read + i ) & MASK ];
+        } // for
+
+        publish_read( read + count );
+
+        return count;
+    }
+
+    /**
+     * \brief Get the largest contiguous free region (producer, zero-copy push).
+     *
+     * Elements written to the region are pushed by
+     * picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::commit().
+     *
+     * \return The largest contiguous free region (may be empty).
+     */
+    auto write_region() noexcept -> Region<T>
+    {
+        auto const write = m_write;
+        auto const index = write & MASK;
+        auto const free  = CAPACITY - ( write - m_read );
+
+        // the consumer must be done reading the free elements before they are written
+        data_memory_barrier();
+
+        return { &m_elements[ index ], free < CAPACITY - index ? free : CAPACITY - index };
+    }
+
+    /**
+     * \brief Push elements written to the region returned by
+     *        picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::write_region() (producer).
+     *
+     * \param[in] count The number of elements to push (must not exceed the region's
+     *            size).
+     */
+    void commit( std::size_t count ) noexcept
+    {
+        publish_write( m_write + count );
+    }
+
+    /**
+     * \brief Get the largest contiguous readable region (consumer, zero-copy pop).
+     *
+     * Elements read from the region are popped by
+     * picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::consume().
+     *
+     * \return The largest contiguous readable region (may be empty).
+     */
+    auto read_region() const noexcept -> Region<T const>
+    {
+        auto const read      = m_read;
+        auto const index     = read & MASK;
+        auto const available = m_write - read;
+
+        // the producer's element writes must be observed before the elements are read
+        data_memory_barrier();
+
+        return { &m_elements[ index ], available < CAPACITY - index ? available : CAPACITY - index };
+    }
+
+    /**
+     * \brief Pop elements read from the region returned by
+     *        picolibrary::Arm::Cortex::M0PLUS::SPSC_Ring_Buffer::read_region() (consumer).
+     *
+     * \param[in] count The number of elements to pop (must not exceed the region's size).
+     */
+    void consume( std::size_t count ) noexcept
+    {
+        publish_read( m_read + count );
+    }
+
+  private:
+    /**
+     * \brief The mask that converts a position into an element index.
+     */
+    static constexpr auto MASK = static_cast<std::uint32_t>( CAPACITY - 1 );
+
+    /**
+     * \brief The elements.
+     */
+    T m_elements[ CAPACITY ]{};
+
+    /**
+     * \brief The free running read position (only written by the consumer).
+     */
+    std::uint32_t volatile m_read{};
+
+    /**
+     * \brief The free running write position (only written by the producer).
+     */
+    std::uint32_t volatile m_write{};
+
+    /**
+     * \brief Publish a new write position.
+     *
+     * \param[in] write The new write position.
+     */
+    void publish_write( std::uint32_t write ) noexcept
+    {
+        // the element writes must be observed before the new write position
+        data_memory_barrier();
+
+        m_write = write;
+    }
+
+    /**
+     * \brief Publish a new read position.
+     *
+     * \param[in] read The new read position.
+     */
+    void publish_read( std::uint32_t read ) noexcept
+    {
+        // the element reads must complete before the new read position is observed
+        data_memory_barrier();
+
+        m_read = read;
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SPSC_RING_BUFFER_H
@@ -0,0 +1,261 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Calibration interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CALIBRATION_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CALIBRATION_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/systick_clock_source.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief SYSTICK peripheral counter configuration computed at run time.
+ */
+struct SYSTICK_Counter_Configuration {
+    /**
+     * \brief The SYSTICK peripheral clock source to use.
+     */
+    SYSTICK_Clock_Source clock_source;
+
+    /**
+     * \brief The SYSTICK peripheral counter reload value to use.
+     */
+    std::uint32_t reload_value;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter reloads required to create the
+     *        desired duration (0 if the desired duration cannot be created).
+     */
+    std::uint32_t ticks;
+};
+
+/**
+ * \brief SYSTICK peripheral calibration service.
+ *
+ * The service interprets the SYSTICK peripheral's CALIB register. TENMS is the reload
+ * value for a 10 ms period, so the frequency of the clock it describes is ( TENMS + 1 ) *
+ * 100 Hz. If the implementation provides a separate reference clock (NOREF is clear),
+ * TENMS describes the external reference clock. If the implementation does not provide a
+ * separate reference clock (NOREF is set), TENMS describes the processor clock. If TENMS
+ * is 0, the calibration value is not known, and a caller supplied processor clock
+ * frequency is used instead. If SKEW is set, TENMS was rounded, and the derived frequency
+ * is accurate to within 1 / ( 2 * ( TENMS + 1 ) ).
+ */
+class SYSTICK_Calibration {
+  public:
+    /**
+     * \brief SYSTICK clock source.
+     */
+    using Clock_Source = SYSTICK_Clock_Source;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] calib The SYSTICK peripheral CALIB register value.
+     */
+    constexpr explicit SYSTICK_Calibration( std::uint32_t calib ) noexcept :
+        m_calib{ calib }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance whose CALIB register should be
+     *            read.
+     */
+    explicit SYSTICK_Calibration( Peripheral::SYSTICK const & systick ) noexcept :
+        SYSTICK_Calibration{ static_cast<std::uint32_t>( systick.calib ) }
+    {
+    }
+
+    /**
+     * \brief Check if the implementation provides a separate external reference clock.
+     *
+     * \return true if the implementation provides a separate external reference clock.
+     * \return false if the implementation does not provide a separate external reference
+     *         clock.
+     */
+    constexpr auto has_reference_clock() const noexcept -> bool
+    {
+        return not( m_calib & Peripheral::SYSTICK::CALIB::Mask::NOREF );
+    }
+
+    /**
+     * \brief Check if the calibration value is known.
+     *
+     * \return true if the calibration value is known.
+     * \return false if the calibration value is not known.
+     */
+    constexpr auto is_known() const noexcept -> bool
+    {
+        return tenms();
+    }
+
+    /**
+     * \brief Check if the calibration value is exact.
+     *
+     * \return true if the calibration value is exact.
+     * \return false if the calibration value was rounded.
+     */
+    constexpr auto is_exact() const noexcept -> bool
+    {
+        return not( m_calib & Peripheral::SYSTICK::CALIB::Mask::SKEW );
+    }
+
+    /**
+     * \brief Get the SYSTICK peripheral counter reload value for a 10 ms period.
+     *
+     * \return The SYSTICK peripheral counter reload value for a 10 ms period (0 if the
+     *         calibration value is not known).
+     */
+    constexpr auto tenms() const noexcept -> std::uint32_t
+    {
+        return m_calib & Peripheral::SYSTICK::CALIB::Mask::TENMS;
+    }
+
+    /**
+     * \brief Get the bound on the error of the frequencies derived from the calibration
+     *        value.
+     *
+     * \return The bound on the error of the frequencies derived from the calibration
+     *         value (ppm, rounded up).
+     * \return 0 if the calibration value is exact or not known.
+     */
+    constexpr auto error_bound() const noexcept -> std::uint32_t
+    {
+        if ( is_exact() or not is_known() ) {
+            return 0;
+        } // if
+
+        auto const counts = 2 * ( std::uint64_t{ tenms() } + 1 );
+
+        return static_cast<std::uint32_t>( ( 1'000'000 + counts - 1 ) / counts );
+    }
+
+    /**
+     * \brief Get the external reference clock frequency.
+     *
+     * \return The external reference clock frequency (Hz).
+     * \return 0 if the implementation does not provide a separate external reference
+     *         clock, or the calibration value is not known.
+     */
+    constexpr auto reference_clock_frequency() const noexcept -> std::uint32_t
+    {
+        if ( not has_reference_clock() or not is_known() ) {
+            return 0;
+        } // if
+
+        return ( tenms() + 1 ) * 100;
+    }
+
+    /**
+     * \brief Get the processor clock frequency.
+     *
+     * \param[in] fallback The processor clock frequency to use if it cannot be derived
+     *            from the calibration value (Hz).
+     *
+     * \return The processor clock frequency (Hz).
+     */
+    constexpr auto processor_clock_frequency( std::uint32_t fallback ) const noexcept -> std::uint32_t
+    {
+        if ( has_reference_clock() or not is_known() ) {
+            return fallback;
+        } // if
+
+        return ( tenms() + 1 ) * 100;
+    }
+
+    /**
+     * \brief Get a SYSTICK peripheral clock source's frequency.
+     *
+     * \param[in] clock_source The SYSTICK peripheral clock source.
+     * \param[in] processor_clock_frequency The processor clock frequency to use if it
+     *            cannot be derived from the calibration value (Hz).
+     *
+     * \return The SYSTICK peripheral clock source's frequency (Hz).
+     * \return 0 if the SYSTICK peripheral clock source's frequency is not known.
+     */
+    constexpr auto clock_frequency( Clock_Source clock_source, std::uint32_t processor_clock_frequency ) const noexcept
+        -> std::uint32_t
+    {
+        return clock_source == Clock_Source::PROCESSOR_CLOCK
+                   ? this->processor_clock_frequency( processor_clock_frequency )
+                   : reference_clock_frequency();
+    }
+
+    /**
+     * \brief Compute the SYSTICK peripheral counter configuration for a duration.
+     *
+     * Each clock source whose frequency is known is considered. The clock source that
+     * creates the duration with the smallest rounding error is selected. If the clock
+     * sources are equally accurate, the clock source that requires the fewest SYSTICK
+     * peripheral counter reloads is selected, and if the clock sources also require the
+     * same number of SYSTICK peripheral counter reloads, the processor clock is selected.
+     *
+     * \tparam Rep The duration tick count type.
+     * \tparam Period The duration tick period.
+     *
+     * \param[in] processor_clock_frequency The processor clock frequency to use if it
+     *            cannot be derived from the calibration value (Hz).
+     * \param[in] duration The duration (the product of the number of SYSTICK peripheral
+     *            counter clock cycles per second, the duration's tick count, and the
+     *            duration's tick period's numerator must fit in 64 bits).
+     *
+     * \return The SYSTICK peripheral counter configuration for the duration (the
+     *         configuration's tick count is 0 if the duration cannot be created).
+     */
+    template<typename Rep, typename Period>
+    auto configure( std::uint32_t processor_clock_frequency, std::chrono::duration<Rep, Period> duration ) const noexcept
+        -> SYSTICK_Counter_Configuration
+    {
+        return configure( processor_clock_frequency, static_cast<std::uint64_t>( duration.count() ), Period::num, Period::den );
+    }
+
+  private:
+    /**
+     * \brief The SYSTICK peripheral CALIB register value.
+     */
+    std::uint32_t m_calib;
+
+    /**
+     * \brief Compute the SYSTICK peripheral counter configuration for a duration.
+     *
+     * \param[in] processor_clock_frequency The processor clock frequency to use if it
+     *            cannot be derived from the calibration value (Hz).
+     * \param[in] count The duration's tick count.
+     * \param[in] numerator The duration's tick period's numerator.
+     * \param[in] denominator The duration's tick period's denominator.
+     *
+     * \return The SYSTICK peripheral counter configuration for the duration.
+     */
+    auto configure( std::uint32_t processor_clock_frequency, std::uint64_t count, std::uint64_t numerator, std::uint64_t denominator ) const noexcept
+        -> SYSTICK_Counter_Configuration;
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CALIBRATION_H
@@ -0,0 +1,42 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Clock_Source interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CLOCK_SOURCE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CLOCK_SOURCE_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief SYSTICK clock source.
+ */
+enum class SYSTICK_Clock_Source : std::uint32_t {
+    EXTERNAL_REFERENCE_CLOCK = 0 << Peripheral::SYSTICK::CSR::Bit::CLKSOURCE, ///< External reference clock.
+    PROCESSOR_CLOCK = 1 << Peripheral::SYSTICK::CSR::Bit::CLKSOURCE, ///< Processor clock.
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_SYSTICK_CLOCK_SOURCE_H
@@ -0,0 +1,265 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Tickless_Idle interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_TICKLESS_IDLE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_TICKLESS_IDLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/timer_wheel.h"
+#include "picolibrary/arm/cortex/m0plus/uptime_clock.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+/**
+ * \brief Tickless idle service.
+ *
+ * The service drives a picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel from a
+ * picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock whose SYSTICK peripheral counter period
+ * is one timer wheel tick. When the processor is idle, the service extends the current
+ * SYSTICK peripheral counter period to the next timer expiration (up to the 24-bit
+ * SYSTICK peripheral counter limit) so that the processor is not woken by ticks during
+ * which no timers expire.
+ *
+ * Ticks are tracked as multiples of the tick period on the uptime clock's timeline, and
+ * every extended SYSTICK peripheral counter period ends on a tick boundary, so sleeping
+ * does not cause the ticks to drift. If the processor is woken early by another interrupt,
+ * the timer wheel is advanced by the ticks that have elapsed before that interrupt is
+ * handled, and the SYSTICK peripheral counter period is shortened to end at the next tick
+ * boundary.
+ *
+ * \attention The SYSTICK interrupt handler must call
+ *            picolibrary::Arm::Cortex::M0PLUS::Tickless_Idle::handle_interrupt() instead
+ *            of picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::handle_interrupt() and
+ *            picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::tick().
+ *
+ * \attention When the processor is woken early, the expiration callbacks of the timers
+ *            that expired while the processor was sleeping are called from
+ *            picolibrary::Arm::Cortex::M0PLUS::Tickless_Idle::idle() after the interrupt
+ *            that woke the processor has been handled.
+ *
+ * \tparam SLOTS The number of timer wheel slots.
+ */
+template<std::size_t SLOTS>
+class Tickless_Idle {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] uptime_clock The uptime clock whose SYSTICK peripheral counter period is
+     *            one timer wheel tick (must be at least
+     *            picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::RESTART_MARGIN SYSTICK
+     *            peripheral counter clock cycles).
+     * \param[in] timer_wheel The timer wheel to drive.
+     */
+    Tickless_Idle( Uptime_Clock & uptime_clock, Timer_Wheel<SLOTS> & timer_wheel ) noexcept :
+        m_uptime_clock{ &uptime_clock },
+        m_timer_wheel{ &timer_wheel },
+        m_tick_period{ uptime_clock.next_period() },
+        m_max_ticks{ ( Peripheral::SYSTICK::RVR::Mask::RELOAD + 1 ) / m_tick_period }
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        if ( m_uptime_clock->is_interrupt_pending() ) {
+            m_last_tick = m_uptime_clock->period_start() + m_uptime_clock->period();
+        } else {
+            m_last_tick = m_uptime_clock->period_start();
+        } // else
+    }
+
+    Tickless_Idle( Tickless_Idle && ) = delete;
+
+    Tickless_Idle( Tickless_Idle const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tickless_Idle() noexcept = default;
+
+    auto operator=( Tickless_Idle && ) = delete;
+
+    auto operator=( Tickless_Idle const & ) = delete;
+
+    /**
+     * \brief Handle a SYSTICK interrupt.
+     *
+     * Every tick that elapsed during the SYSTICK peripheral counter period that ended is
+     * processed.
+     */
+    void handle_interrupt() noexcept
+    {
+        m_uptime_clock->handle_interrupt();
+
+        m_timer_wheel->advance( elapse( m_uptime_clock->period_start() ) );
+
+        m_timer_wheel->dispatch();
+    }
+
+    /**
+     * \brief Sleep until the next interrupt, extending the current SYSTICK peripheral
+     *        counter period to the next timer expiration if possible.
+     *
+     * This function is intended to be called from the main loop when there is no work to
+     * do. The interrupt that wakes the processor is handled once the PRIMASK register
+     * value that this function was called with is restored, after which the expiration
+     * callbacks of the timers that expired while the processor was sleeping are called.
+     */
+    void idle() noexcept
+    {
+        {
+            // WFI is executed with interrupts disabled so that an interrupt that becomes
+            // pending after the checks still wakes the processor, but is not handled
+            // until the timer wheel has been advanced by the elapsed ticks
+            Interrupt::Critical_Section_Guard const guard;
+
+            if ( not m_uptime_clock->is_interrupt_pending() ) {
+                if ( extend() ) {
+                    wait_for_interrupt();
+
+                    if ( not m_uptime_clock->is_interrupt_pending() ) {
+                        resume();
+                    } // if
+                } else {
+                    wait_for_interrupt();
+                } // else
+            }     // if
+        }
+
+        m_timer_wheel->dispatch();
+    }
+
+  private:
+    /**
+     * \brief The uptime clock whose SYSTICK peripheral counter period is one timer wheel
+     *        tick.
+     */
+    Uptime_Clock * m_uptime_clock;
+
+    /**
+     * \brief The timer wheel being driven.
+     */
+    Timer_Wheel<SLOTS> * m_timer_wheel;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles in a tick.
+     */
+    std::uint32_t m_tick_period;
+
+    /**
+     * \brief The maximum number of ticks in a SYSTICK peripheral counter period.
+     */
+    std::uint32_t m_max_ticks;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles that had elapsed at the
+     *        last tick that was processed.
+     */
+    Uptime_Clock::Ticks m_last_tick{};
+
+    /**
+     * \brief Extend the current SYSTICK peripheral counter period to the tick at which the
+     *        next timer expires.
+     *
+     * \attention This function must be called with interrupts disabled and the SYSTICK
+     *            interrupt not pending.
+     *
+     * \return true if the current SYSTICK peripheral counter period was extended.
+     * \return false if the current SYSTICK peripheral counter period could not be
+     *         extended.
+     */
+    auto extend() noexcept -> bool
+    {
+        auto ticks = m_timer_wheel->ticks_until_next_expiration();
+        if ( not ticks or ticks > m_max_ticks ) {
+            ticks = m_max_ticks;
+        } // if
+
+        auto const end = m_last_tick + static_cast<Uptime_Clock::Ticks>( ticks ) * m_tick_period;
+
+        if ( end <= m_uptime_clock->period_start() + m_uptime_clock->period()
+             or end - m_uptime_clock->now() < Uptime_Clock::RESTART_MARGIN ) {
+            return false;
+        } // if
+
+        m_uptime_clock->restart_period( end );
+
+        return true;
+    }
+
+    /**
+     * \brief Account for the ticks that have elapsed since the last tick that was
+     *        processed.
+     *
+     * \param[in] now The number of SYSTICK peripheral counter clock cycles that have
+     *            elapsed.
+     *
+     * \return The number of ticks that have elapsed since the last tick that was
+     *         processed.
+     */
+    auto elapse( Uptime_Clock::Ticks now ) noexcept -> std::uint32_t
+    {
+        // a SYSTICK peripheral counter period is at most m_max_ticks ticks long, so
+        // counting avoids a 64-bit division
+        auto ticks = std::uint32_t{};
+
+        while ( now - m_last_tick >= m_tick_period ) {
+            m_last_tick += m_tick_period;
+
+            ++ticks;
+        } // while
+
+        return ticks;
+    }
+
+    /**
+     * \brief Advance the timer wheel by the ticks that elapsed while the processor was
+     *        sleeping (without calling expiration callbacks), and shorten the extended
+     *        SYSTICK peripheral counter period to end at the next tick boundary.
+     *
+     * \attention This function must be called with interrupts disabled and the SYSTICK
+     *            interrupt not pending.
+     */
+    void resume() noexcept
+    {
+        m_timer_wheel->advance( elapse( m_uptime_clock->now() ) );
+
+        auto end = m_last_tick + m_tick_period;
+        if ( end - m_uptime_clock->now() < Uptime_Clock::RESTART_MARGIN ) {
+            end += m_tick_period;
+        } // if
+
+        if ( end < m_uptime_clock->period_start() + m_uptime_clock->period() ) {
+            m_uptime_clock->restart_period( end );
+        } // if
+    }
+};
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_TICKLESS_IDLE_H
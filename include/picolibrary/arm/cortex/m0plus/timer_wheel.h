@@ -0,0 +1,395 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_TIMER_WHEEL_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+template<std::size_t SLOTS>
+class Timer_Wheel;
+
+/**
+ * \brief Software timer.
+ *
+ * Software timers are managed by a picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel. A
+ * software timer stores the links used to place it in a timer wheel slot, so starting and
+ * stopping a software timer does not require any additional storage.
+ *
+ * \attention A software timer must be stopped before it is destroyed.
+ */
+class Software_Timer {
+  public:
+    /**
+     * \brief Expiration callback.
+     */
+    using Callback = void ( * )( void * context );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] callback The function to call when the timer expires.
+     * \param[in] context The context to pass to the function that is called when the
+     *            timer expires.
+     */
+    constexpr Software_Timer( Callback callback, void * context ) noexcept :
+        m_callback{ callback },
+        m_context{ context }
+    {
+    }
+
+    Software_Timer( Software_Timer && ) = delete;
+
+    Software_Timer( Software_Timer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Software_Timer() noexcept = default;
+
+    auto operator=( Software_Timer && ) = delete;
+
+    auto operator=( Software_Timer const & ) = delete;
+
+    /**
+     * \brief Check if the timer is running.
+     *
+     * \return true if the timer is running.
+     * \return false if the timer is not running.
+     */
+    auto is_running() const noexcept -> bool
+    {
+        return m_link;
+    }
+
+  private:
+    template<std::size_t SLOTS>
+    friend class Timer_Wheel;
+
+    /**
+     * \brief The function to call when the timer expires.
+     */
+    Callback m_callback;
+
+    /**
+     * \brief The context to pass to the function that is called when the timer expires.
+     */
+    void * m_context;
+
+    /**
+     * \brief The number of complete timer wheel revolutions remaining before the timer
+     *        expires (the number of ticks that elapsed after the timer expired if the
+     *        timer has expired but its expiration callback has not been called yet).
+     */
+    std::uint32_t m_rounds{};
+
+    /**
+     * \brief The timer's period in ticks (0 if the timer is a one-shot timer).
+     */
+    std::uint32_t m_period{};
+
+    /**
+     * \brief The next timer in the list the timer is in.
+     */
+    Software_Timer * m_next{};
+
+    /**
+     * \brief The pointer that points to the timer in the list the timer is in (nullptr if
+     *        the timer is not running).
+     */
+    Software_Timer ** m_link{};
+
+    /**
+     * \brief Insert the timer at the front of a list.
+     *
+     * \param[in] head The list's head.
+     */
+    void link( Software_Timer *& head ) noexcept
+    {
+        m_next = head;
+        if ( m_next ) {
+            m_next->m_link = &m_next;
+        } // if
+
+        m_link = &head;
+        head   = this;
+    }
+
+    /**
+     * \brief Remove the timer from the list it is in.
+     */
+    void unlink() noexcept
+    {
+        if ( m_link ) {
+            *m_link = m_next;
+            if ( m_next ) {
+                m_next->m_link = m_link;
+            } // if
+
+            m_link = nullptr;
+        } // if
+    }
+};
+
+/**
+ * \brief Hashed timer wheel.
+ *
+ * Starting and stopping a timer are O(1) operations. Each tick only visits the timers in
+ * a single slot, and advancing the wheel by several ticks visits each slot at most once.
+ * Timers that are more than SLOTS ticks from expiring track the number of remaining wheel
+ * revolutions.
+ *
+ * picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::tick() is normally called from the
+ * SYSTICK interrupt handler, but it can also be called from a deferred context (e.g. a
+ * PENDSV interrupt handler or the main loop) if expiration callbacks should not run from
+ * the SYSTICK interrupt handler. Advancing the wheel
+ * (picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::advance()) and calling the expiration
+ * callbacks of the timers that expired
+ * (picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::dispatch()) can also be done separately,
+ * so that the wheel can be advanced with interrupts disabled. Timers can be started and
+ * stopped from any context, including from expiration callbacks.
+ *
+ * \tparam SLOTS The number of wheel slots (must be a power of 2).
+ */
+template<std::size_t SLOTS>
+class Timer_Wheel {
+  public:
+    static_assert( SLOTS > 0 and ( SLOTS & ( SLOTS - 1 ) ) == 0, "SLOTS must be a power of 2" );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timer_Wheel() noexcept = default;
+
+    Timer_Wheel( Timer_Wheel && ) = delete;
+
+    Timer_Wheel( Timer_Wheel const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timer_Wheel() noexcept = default;
+
+    auto operator=( Timer_Wheel && ) = delete;
+
+    auto operator=( Timer_Wheel const & ) = delete;
+
+    /**
+     * \brief Start a timer.
+     *
+     * If the timer is already running, it is restarted.
+     *
+     * \param[in] timer The timer to start.
+     * \param[in] ticks The number of ticks until the timer expires (must be non-zero).
+     * \param[in] period The timer's period in ticks (0 if the timer is a one-shot timer).
+     */
+    void start( Software_Timer & timer, std::uint32_t ticks, std::uint32_t period = 0 ) noexcept
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        timer.unlink();
+
+        timer.m_period = period;
+
+        insert( timer, ticks );
+    }
+
+    /**
+     * \brief Stop a timer.
+     *
+     * Stopping a timer that is not running has no effect.
+     *
+     * \param[in] timer The timer to stop.
+     */
+    void stop( Software_Timer & timer ) noexcept
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        timer.unlink();
+    }
+
+    /**
+     * \brief Advance the wheel by one tick, and call the expiration callbacks of the
+     *        timers that expire.
+     */
+    void tick() noexcept
+    {
+        advance( 1 );
+
+        dispatch();
+    }
+
+    /**
+     * \brief Advance the wheel by a number of ticks without calling the expiration
+     *        callbacks of the timers that expire.
+     *
+     * Each slot is visited at most once, regardless of the number of ticks. The expiration
+     * callbacks of the timers that expire are called by the next call to
+     * picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::dispatch() (or
+     * picolibrary::Arm::Cortex::M0PLUS::Timer_Wheel::tick()). Periodic timers that expire
+     * are restarted relative to the tick at which they expired, even if several of their
+     * periods elapse during the advance (their expiration callbacks are only called once).
+     *
+     * \param[in] ticks The number of ticks to advance the wheel by.
+     */
+    void advance( std::uint32_t ticks ) noexcept
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        auto const slots = ticks < SLOTS ? ticks : static_cast<std::uint32_t>( SLOTS );
+
+        for ( auto offset = std::uint32_t{ 1 }; offset <= slots; ++offset ) {
+            // SLOTS is a power of 2, so this division compiles to a shift
+            auto const visits = ( ticks - offset ) / SLOTS + 1;
+
+            for ( auto timer = m_slots[ ( m_slot + offset ) & ( SLOTS - 1 ) ]; timer; ) {
+                auto const next = timer->m_next;
+
+                if ( timer->m_rounds >= visits ) {
+                    timer->m_rounds -= visits;
+                } else {
+                    timer->m_rounds = ticks - ( timer->m_rounds * static_cast<std::uint32_t>( SLOTS ) + offset );
+
+                    timer->unlink();
+                    timer->link( m_expired );
+                } // else
+
+                timer = next;
+            } // for
+        }     // for
+
+        m_slot = ( m_slot + ticks ) & ( SLOTS - 1 );
+    }
+
+    /**
+     * \brief Call the expiration callbacks of the timers that expired.
+     *
+     * Expiration callbacks are called with the interrupt state that this function was
+     * called with (interrupts are only disabled while the wheel is updated).
+     */
+    void dispatch() noexcept
+    {
+        // expiration callbacks may start or stop any timer, including timers that have
+        // expired but whose callbacks have not been called yet
+        for ( ;; ) {
+            Software_Timer * timer;
+
+            {
+                Interrupt::Critical_Section_Guard const guard;
+
+                timer = m_expired;
+                if ( not timer ) {
+                    break;
+                } // if
+
+                timer->unlink();
+
+                if ( timer->m_period ) {
+                    // avoid a runtime division in the common case of a timer that
+                    // expired during the last tick
+                    auto const overrun = timer->m_rounds < timer->m_period
+                                             ? timer->m_rounds
+                                             : timer->m_rounds % timer->m_period;
+
+                    insert( *timer, timer->m_period - overrun );
+                } // if
+            }
+
+            timer->m_callback( timer->m_context );
+        } // for
+    }
+
+    /**
+     * \brief Get the number of ticks until the next timer expires.
+     *
+     * This visits every running timer in the worst case, so it is intended for idle
+     * processing (e.g. picolibrary::Arm::Cortex::M0PLUS::Tickless_Idle) rather than for
+     * every tick.
+     *
+     * \return The number of ticks until the next timer expires.
+     * \return 0 if no timers are running.
+     */
+    auto ticks_until_next_expiration() const noexcept -> std::uint32_t
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        auto ticks = std::uint32_t{};
+
+        for ( auto offset = std::uint32_t{ 1 }; offset <= SLOTS; ++offset ) {
+            for ( auto timer = m_slots[ ( m_slot + offset ) & ( SLOTS - 1 ) ]; timer;
+                  timer      = timer->m_next ) {
+                auto const timer_ticks = timer->m_rounds * static_cast<std::uint32_t>( SLOTS ) + offset;
+
+                if ( not ticks or timer_ticks < ticks ) {
+                    ticks = timer_ticks;
+                } // if
+            }     // for
+
+            // timers in later slots expire at least one tick later
+            if ( ticks == offset ) {
+                break;
+            } // if
+        }     // for
+
+        return ticks;
+    }
+
+  private:
+    /**
+     * \brief The wheel slots.
+     */
+    Software_Timer * m_slots[ SLOTS ]{};
+
+    /**
+     * \brief The current slot.
+     */
+    std::size_t m_slot{};
+
+    /**
+     * \brief The timers that have expired but whose expiration callbacks have not been
+     *        called yet.
+     */
+    Software_Timer * m_expired{};
+
+    /**
+     * \brief Insert a timer into the wheel.
+     *
+     * \param[in] timer The timer to insert.
+     * \param[in] ticks The number of ticks until the timer expires (must be non-zero).
+     */
+    void insert( Software_Timer & timer, std::uint32_t ticks ) noexcept
+    {
+        // SLOTS is a power of 2, so these divisions compile to shifts
+        timer.m_rounds = ( ticks - 1 ) / SLOTS;
+
+        timer.link( m_slots[ ( m_slot + ticks ) & ( SLOTS - 1 ) ] );
+    }
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_TIMER_WHEEL_H
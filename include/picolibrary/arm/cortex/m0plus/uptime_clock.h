@@ -0,0 +1,450 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_UPTIME_CLOCK_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_UPTIME_CLOCK_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/systick_calibration.h"
+#include "picolibrary/arm/cortex/m0plus/systick_clock_source.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+/**
+ * \brief Monotonic 64-bit uptime clock.
+ *
+ * The clock extends the SYSTICK peripheral's 24-bit counter to 64 bits by accumulating
+ * the length of each counter period in the SYSTICK interrupt handler. Reading the clock
+ * never disables interrupts. Counter periods do not have to be the same length (see
+ * picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::set_next_period() and
+ * picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::restart_period()).
+ *
+ * \attention The SYSTICK interrupt handler must call
+ *            picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::handle_interrupt().
+ *
+ * \attention picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::now() must not be called
+ *            from an interrupt handler that can preempt the SYSTICK interrupt handler.
+ */
+class Uptime_Clock {
+  public:
+    /**
+     * \brief SYSTICK clock source.
+     */
+    using Clock_Source = SYSTICK_Clock_Source;
+
+    /**
+     * \brief Clock tick count (SYSTICK peripheral clock cycles).
+     */
+    using Ticks = std::uint64_t;
+
+    /**
+     * \brief Span of the clock's timeline during which the SYSTICK peripheral counter
+     *        clock frequency does not change.
+     */
+    struct Epoch {
+        /**
+         * \brief The number of SYSTICK peripheral counter clock cycles that had elapsed
+         *        when the epoch started.
+         */
+        Ticks start;
+
+        /**
+         * \brief The SYSTICK peripheral counter clock frequency during the epoch (Hz, 0 if
+         *        the clock has not been reconfigured with a frequency).
+         */
+        std::uint32_t frequency;
+    };
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to keep time.
+     * \param[in] scb The SCB peripheral instance to use to check if the SYSTICK interrupt
+     *            is pending.
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use (must
+     *            be non-zero).
+     *
+     * \attention The clock will use the processor clock if the external reference clock
+     *            is requested but is not available.
+     */
+    Uptime_Clock( Peripheral::SYSTICK & systick, Peripheral::SCB & scb, Clock_Source clock_source, std::uint32_t reload_value ) noexcept
+        :
+        m_systick{ &systick },
+        m_scb{ &scb },
+        m_period{ reload_value + 1 },
+        m_next_period{ reload_value + 1 }
+    {
+        m_systick->rvr = reload_value;
+        m_systick->cvr = 0;
+        m_systick->csr = to_underlying( clock_source ) | Peripheral::SYSTICK::CSR::Mask::TICKINT
+                         | Peripheral::SYSTICK::CSR::Mask::ENABLE;
+
+        // the external reference clock is much slower than the processor clock, so the
+        // restart latency is less than one external reference clock cycle
+        m_restart_latency = ( m_systick->csr & Peripheral::SYSTICK::CSR::Mask::CLKSOURCE )
+                                ? RESTART_LATENCY
+                                : 0;
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] systick The SYSTICK peripheral instance to use to keep time.
+     * \param[in] scb The SCB peripheral instance to use to check if the SYSTICK interrupt
+     *            is pending.
+     * \param[in] configuration The run time SYSTICK peripheral counter configuration for
+     *            the desired SYSTICK peripheral counter period (see
+     *            picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Calibration::configure(), the
+     *            configuration's tick count must be 1).
+     */
+    Uptime_Clock( Peripheral::SYSTICK & systick, Peripheral::SCB & scb, SYSTICK_Counter_Configuration const & configuration ) noexcept
+        :
+        Uptime_Clock{ systick, scb, configuration.clock_source, configuration.reload_value }
+    {
+    }
+
+    Uptime_Clock( Uptime_Clock && ) = delete;
+
+    Uptime_Clock( Uptime_Clock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Uptime_Clock() noexcept
+    {
+        m_systick->rvr = 0;
+        m_systick->csr = 0;
+    }
+
+    auto operator=( Uptime_Clock && ) = delete;
+
+    auto operator=( Uptime_Clock const & ) = delete;
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter clock cycles that have elapsed
+     *        since the clock was started.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles that have elapsed
+     *         since the clock was started.
+     */
+    auto now() const noexcept -> Ticks
+    {
+        for ( ;; ) {
+            auto const elapsed_low  = m_elapsed_low;
+            auto const elapsed_high = m_elapsed_high;
+
+            auto elapsed = ( static_cast<Ticks>( elapsed_high ) << 32 ) | elapsed_low;
+            auto period  = m_period;
+            auto current = static_cast<std::uint32_t>( m_systick->cvr );
+
+            // the counter reached 0 but the SYSTICK interrupt handler has not run yet,
+            // re-read the counter to guarantee that it is read after the reload
+            if ( m_scb->icsr & Peripheral::SCB::ICSR::Mask::PENDSTSET ) {
+                elapsed += period;
+                period  = m_next_period;
+                current = m_systick->cvr;
+            } // if
+
+            // every update adds a non-zero period that is less than 2^32 to the elapsed
+            // count, so an unchanged low word means the SYSTICK interrupt handler did not
+            // run while the elapsed count was being read
+            if ( m_elapsed_low == elapsed_low ) {
+                return elapsed + ( current ? period - current : 0 );
+            } // if
+        } // for
+    }
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter clock cycles in the current
+     *        SYSTICK peripheral counter period.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles in the current
+     *         SYSTICK peripheral counter period.
+     */
+    auto period() const noexcept -> std::uint32_t
+    {
+        return m_period;
+    }
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter clock cycles that had elapsed
+     *        when the current SYSTICK peripheral counter period started.
+     *
+     * \attention This function must only be called from the SYSTICK interrupt handler,
+     *            or with interrupts disabled and the SYSTICK interrupt not pending.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles that had elapsed when
+     *         the current SYSTICK peripheral counter period started.
+     */
+    auto period_start() const noexcept -> Ticks
+    {
+        return ( static_cast<Ticks>( m_elapsed_high ) << 32 ) | m_elapsed_low;
+    }
+
+    /**
+     * \brief Get the number of SYSTICK peripheral counter clock cycles in the SYSTICK
+     *        peripheral counter periods that follow the current SYSTICK peripheral
+     *        counter period.
+     *
+     * \return The number of SYSTICK peripheral counter clock cycles in the SYSTICK
+     *         peripheral counter periods that follow the current SYSTICK peripheral
+     *         counter period.
+     */
+    auto next_period() const noexcept -> std::uint32_t
+    {
+        return m_next_period;
+    }
+
+    /**
+     * \brief Set the number of SYSTICK peripheral counter clock cycles in the SYSTICK
+     *        peripheral counter periods that follow the current SYSTICK peripheral
+     *        counter period.
+     *
+     * The SYSTICK peripheral loads the new reload value when the current SYSTICK
+     * peripheral counter period ends, so the current SYSTICK peripheral counter period is
+     * not affected.
+     *
+     * \attention This function must only be called from the SYSTICK interrupt handler,
+     *            or with interrupts disabled and the SYSTICK interrupt not pending.
+     *
+     * \param[in] period The number of SYSTICK peripheral counter clock cycles in the
+     *            SYSTICK peripheral counter periods that follow the current SYSTICK
+     *            peripheral counter period (must be greater than 1 and less than or equal
+     *            to 2^24).
+     */
+    void set_next_period( std::uint32_t period ) noexcept
+    {
+        m_systick->rvr = period - 1;
+        m_next_period  = period;
+    }
+
+    /**
+     * \brief End the current SYSTICK peripheral counter period early, and start a new
+     *        SYSTICK peripheral counter period that ends at the requested time.
+     *
+     * The elapsed time is folded into the clock before the counter is restarted, so the
+     * clock does not drift (the restart is accurate to within one SYSTICK peripheral
+     * counter clock cycle). The SYSTICK peripheral counter periods that follow the new
+     * SYSTICK peripheral counter period are
+     * picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::next_period() SYSTICK peripheral
+     * counter clock cycles long. If the current SYSTICK peripheral counter period is
+     * within picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::WRAP_MARGIN SYSTICK
+     * peripheral counter clock cycles of its end, the SYSTICK peripheral counter is not
+     * restarted until the current SYSTICK peripheral counter period has ended.
+     *
+     * \attention This function must be called with interrupts disabled.
+     *
+     * \param[in] end The number of SYSTICK peripheral counter clock cycles that will have
+     *            elapsed when the new SYSTICK peripheral counter period ends (must be at
+     *            least picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::RESTART_MARGIN and
+     *            at most 2^24 SYSTICK peripheral counter clock cycles after
+     *            picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::now()).
+     */
+    void restart_period( Ticks end ) noexcept;
+
+    /**
+     * \brief Change the SYSTICK peripheral clock source and counter reload value without
+     *        losing elapsed time.
+     *
+     * The elapsed part of the current SYSTICK peripheral counter period is folded into the
+     * clock before the SYSTICK peripheral counter is restarted with the new configuration,
+     * so the elapsed time is preserved to within one SYSTICK peripheral counter clock
+     * cycle. The new SYSTICK peripheral counter period is reload_value + 1 SYSTICK
+     * peripheral counter clock cycles long. If a one-off SYSTICK peripheral counter period
+     * is programmed (see picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::set_next_period()
+     * and picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::restart_period()), the SYSTICK
+     * peripheral counter periods that follow the new SYSTICK peripheral counter period
+     * are not changed. Otherwise, they are also reload_value + 1 SYSTICK peripheral
+     * counter clock cycles long. If the current SYSTICK peripheral counter period is
+     * within picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::WRAP_MARGIN SYSTICK
+     * peripheral counter clock cycles of its end, the SYSTICK peripheral counter is not
+     * restarted until the current SYSTICK peripheral counter period has ended, so the end
+     * of the current SYSTICK peripheral counter period cannot be lost (and the epoch
+     * started by the overload that takes a frequency starts at the correct tick).
+     *
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use (must
+     *            be at least picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::RESTART_MARGIN).
+     *
+     * \attention The SYSTICK peripheral counter clock frequency must not change. Use the
+     *            overload that starts a new epoch if it does.
+     */
+    void reconfigure( Clock_Source clock_source, std::uint32_t reload_value ) noexcept;
+
+    /**
+     * \brief Change the SYSTICK peripheral clock source, counter reload value, and counter
+     *        clock frequency without losing elapsed time, and start a new epoch.
+     *
+     * This is intended for dynamic processor clock scaling. The clock keeps counting
+     * SYSTICK peripheral counter clock cycles, so it remains monotonic and the tick values
+     * obtained before the change (e.g. deadline expirations) remain valid points on the
+     * clock's timeline. The new epoch records the tick at which the change took effect
+     * and the new SYSTICK peripheral counter clock frequency, so that ticks can be
+     * converted to time (see picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::epoch()).
+     *
+     * \param[in] clock_source The SYSTICK peripheral clock source to use.
+     * \param[in] reload_value The SYSTICK peripheral counter reload value to use (must
+     *            be at least picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::RESTART_MARGIN).
+     * \param[in] frequency The SYSTICK peripheral counter clock frequency after the change
+     *            (Hz).
+     *
+     * \attention Tick counts that express durations (e.g. timeouts) are in cycles of the
+     *            SYSTICK peripheral counter clock that is running when they elapse.
+     */
+    void reconfigure( Clock_Source clock_source, std::uint32_t reload_value, std::uint32_t frequency ) noexcept;
+
+    /**
+     * \brief Get the current epoch.
+     *
+     * \return The current epoch.
+     */
+    auto epoch() const noexcept -> Epoch;
+
+    /**
+     * \brief Check if the SYSTICK interrupt is pending.
+     *
+     * \return true if the SYSTICK interrupt is pending.
+     * \return false if the SYSTICK interrupt is not pending.
+     */
+    auto is_interrupt_pending() const noexcept -> bool
+    {
+        return m_scb->icsr & Peripheral::SCB::ICSR::Mask::PENDSTSET;
+    }
+
+    /**
+     * \brief Handle a SYSTICK interrupt.
+     */
+    void handle_interrupt() noexcept
+    {
+        auto const elapsed = period_start() + m_period;
+
+        m_elapsed_low  = static_cast<std::uint32_t>( elapsed );
+        m_elapsed_high = static_cast<std::uint32_t>( elapsed >> 32 );
+
+        m_period = m_next_period;
+    }
+
+    /**
+     * \brief The minimum number of SYSTICK peripheral counter clock cycles between a call
+     *        to
+     *        picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::now() and the end of a
+     *        SYSTICK peripheral counter period started by a subsequent call to
+     *        picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::restart_period().
+     */
+    static constexpr auto RESTART_MARGIN = std::uint32_t{ 256 };
+
+  private:
+    /**
+     * \brief The number of processor clock cycles between the counter read and the
+     *        counter write performed by
+     *        picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::restart_period() (LDR, ADDS,
+     *        STR, STR).
+     */
+    static constexpr auto RESTART_LATENCY = std::uint32_t{ 5 };
+
+    /**
+     * \brief The number of processor clock cycles between the counter read and the
+     *        counter write performed by
+     *        picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::reconfigure() (LDR, STR,
+     *        STR).
+     */
+    static constexpr auto RECONFIGURE_LATENCY = std::uint32_t{ 4 };
+
+    /**
+     * \brief The SYSTICK peripheral counter value that the SYSTICK peripheral counter
+     *        must be above before it is read and restarted, so that the SYSTICK peripheral
+     *        counter period cannot end between the check and the counter read (the
+     *        instructions between the two take far fewer processor clock cycles).
+     */
+    static constexpr auto WRAP_MARGIN = std::uint32_t{ 64 };
+
+    /**
+     * \brief The SYSTICK peripheral instance used to keep time.
+     */
+    Peripheral::SYSTICK * m_systick;
+
+    /**
+     * \brief The SCB peripheral instance used to check if the SYSTICK interrupt is
+     *        pending.
+     */
+    Peripheral::SCB * m_scb;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles in the current
+     *        SYSTICK peripheral counter period.
+     */
+    std::uint32_t volatile m_period;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles in the SYSTICK
+     *        peripheral counter periods that follow the current SYSTICK peripheral
+     *        counter period.
+     */
+    std::uint32_t volatile m_next_period;
+
+    /**
+     * \brief The number of SYSTICK peripheral counter clock cycles between the counter
+     *        read and the counter write performed by
+     *        picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::restart_period().
+     */
+    std::uint32_t m_restart_latency{};
+
+    /**
+     * \brief The current epoch.
+     */
+    Epoch m_epoch{};
+
+    /**
+     * \brief The low word of the number of SYSTICK peripheral counter clock cycles that
+     *        had elapsed when the SYSTICK peripheral counter last reached 0.
+     */
+    std::uint32_t volatile m_elapsed_low{};
+
+    /**
+     * \brief The high word of the number of SYSTICK peripheral counter clock cycles
+     *        that had elapsed when the SYSTICK peripheral counter last reached 0.
+     */
+    std::uint32_t volatile m_elapsed_high{};
+
+    /**
+     * \brief Account for SYSTICK peripheral counter periods that ended but whose SYSTICK
+     *        interrupts have not been handled, and wait for the SYSTICK peripheral counter
+     *        to be more than picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock::WRAP_MARGIN
+     *        SYSTICK peripheral counter clock cycles from the end of the current SYSTICK
+     *        peripheral counter period.
+     *
+     * \attention This function must be called with interrupts disabled.
+     */
+    void handle_pending_interrupt() noexcept;
+};
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_UPTIME_CLOCK_H
@@ -0,0 +1,281 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Interrupt::make_vector_table() interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_VECTOR_TABLE_BUILDER_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_VECTOR_TABLE_BUILDER_H
+
+#include <cstddef>
+#include <utility>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt {
+
+/**
+ * \brief Exception number, using IRQ numbering (the reset exception is IRQ -15, and
+ *        external interrupt n is IRQ n).
+ */
+using IRQ_Number = int;
+
+/**
+ * \brief Reset exception IRQ number.
+ */
+constexpr auto RESET_IRQ = IRQ_Number{ -15 };
+
+/**
+ * \brief NMI exception IRQ number.
+ */
+constexpr auto NMI_IRQ = IRQ_Number{ -14 };
+
+/**
+ * \brief Hard fault exception IRQ number.
+ */
+constexpr auto HARD_FAULT_IRQ = IRQ_Number{ -13 };
+
+/**
+ * \brief SVCALL exception IRQ number.
+ */
+constexpr auto SVCALL_IRQ = IRQ_Number{ -5 };
+
+/**
+ * \brief PENDSV exception IRQ number.
+ */
+constexpr auto PENDSV_IRQ = IRQ_Number{ -2 };
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+/**
+ * \brief SYSTICK0 exception IRQ number.
+ */
+constexpr auto SYSTICK0_IRQ = IRQ_Number{ -1 };
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+/**
+ * \brief Interrupt vector table binding.
+ *
+ * \tparam IRQ_NUMBER The IRQ number of the exception to bind the handler to.
+ * \tparam HANDLER The handler to bind to the exception.
+ */
+template<IRQ_Number IRQ_NUMBER, Handler HANDLER>
+struct Binding {
+    /**
+     * \brief The IRQ number of the exception the handler is bound to.
+     */
+    static constexpr auto IRQ = IRQ_NUMBER;
+
+    /**
+     * \brief The handler bound to the exception.
+     */
+    static constexpr auto BOUND_HANDLER = HANDLER;
+};
+
+namespace Implementation {
+
+/**
+ * \brief Placeholder that initializes any interrupt vector table entry.
+ */
+struct Any_Vector {
+    /**
+     * \brief Convert to a handler.
+     *
+     * \return nullptr.
+     */
+    constexpr operator Handler() const noexcept
+    {
+        return nullptr;
+    }
+};
+
+/**
+ * \brief Check if picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table has at least
+ *        a specific number of handler entries.
+ *
+ * \tparam I The handler entry indices.
+ *
+ * \return true.
+ */
+template<std::size_t... I>
+constexpr auto has_vectors( std::index_sequence<I...> ) noexcept
+    -> decltype( Vector_Table{ static_cast<void *>( nullptr ), ( static_cast<void>( I ), Any_Vector{} )... }, bool{} )
+{
+    return true;
+}
+
+/**
+ * \brief Check if picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table has at least
+ *        a specific number of handler entries.
+ *
+ * \return false.
+ */
+constexpr auto has_vectors( ... ) noexcept -> bool
+{
+    return false;
+}
+
+/**
+ * \brief Count picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table's handler
+ *        entries.
+ *
+ * Vector_Table's alignment pads its size, so the entries are counted by finding the
+ * largest number of handlers the aggregate can be initialized with.
+ *
+ * \tparam N The number of handler entries to check for.
+ *
+ * \return The number of handler entries.
+ */
+template<std::size_t N = 1>
+constexpr auto vectors() noexcept -> std::size_t
+{
+    if constexpr ( has_vectors( std::make_index_sequence<N + 1>{} ) ) {
+        return vectors<N + 1>();
+    } else {
+        return N;
+    } // else
+}
+
+/**
+ * \brief Check if an IRQ number identifies a reserved interrupt vector table entry.
+ *
+ * \param[in] irq The IRQ number to check.
+ *
+ * \return true if the IRQ number identifies a reserved interrupt vector table entry.
+ * \return false if the IRQ number does not identify a reserved interrupt vector table
+ *         entry.
+ */
+constexpr auto is_reserved( IRQ_Number irq ) noexcept -> bool
+{
+    return ( irq >= -12 and irq <= -6 ) or irq == -4 or irq == -3
+#if not PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+           or irq == -1
+#endif // not PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+        ;
+}
+
+/**
+ * \brief Get the handler for an interrupt vector table entry.
+ *
+ * \tparam DEFAULT_HANDLER The handler for entries that are not bound.
+ * \tparam Bindings The bindings.
+ *
+ * \param[in] irq The entry's IRQ number.
+ *
+ * \return The handler for the interrupt vector table entry.
+ */
+template<Handler DEFAULT_HANDLER, typename... Bindings>
+constexpr auto handler( IRQ_Number irq ) noexcept -> Handler
+{
+    if ( is_reserved( irq ) ) {
+        return nullptr;
+    } // if
+
+    auto result = DEFAULT_HANDLER;
+
+    static_cast<void>( ( ( Bindings::IRQ == irq ? ( result = Bindings::BOUND_HANDLER, true ) : false ) or ... ) );
+
+    return result;
+}
+
+/**
+ * \brief Check if an exception is bound more than once.
+ *
+ * \tparam Bindings The bindings.
+ *
+ * \return true if an exception is bound more than once.
+ * \return false if no exception is bound more than once.
+ */
+template<typename... Bindings>
+constexpr auto has_duplicate_binding() noexcept -> bool
+{
+    constexpr IRQ_Number irqs[] = { Bindings::IRQ..., 0 };
+
+    for ( auto i = std::size_t{}; i < sizeof...( Bindings ); ++i ) {
+        for ( auto j = i + 1; j < sizeof...( Bindings ); ++j ) {
+            if ( irqs[ i ] == irqs[ j ] ) {
+                return true;
+            } // if
+        }     // for
+    }         // for
+
+    return false;
+}
+
+/**
+ * \brief Build an interrupt vector table.
+ *
+ * \tparam DEFAULT_HANDLER The handler for entries that are not bound.
+ * \tparam Bindings The bindings.
+ * \tparam I The handler entry indices.
+ *
+ * \param[in] stack The initial stack pointer value.
+ *
+ * \return The interrupt vector table.
+ */
+template<Handler DEFAULT_HANDLER, typename... Bindings, std::size_t... I>
+constexpr auto make_vector_table( void * stack, std::index_sequence<I...> ) noexcept -> Vector_Table
+{
+    return Vector_Table{ stack, handler<DEFAULT_HANDLER, Bindings...>( static_cast<IRQ_Number>( I ) - 15 )... };
+}
+
+} // namespace Implementation
+
+/**
+ * \brief The number of handler entries in
+ *        picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table.
+ */
+constexpr auto VECTORS = Implementation::vectors();
+
+/**
+ * \brief Build an interrupt vector table at compile time.
+ *
+ * Unbound entries are filled with the default handler, and reserved entries are filled
+ * with nullptr. Compilation fails if the reset exception is not bound, if an exception is
+ * bound more than once, or if a binding's IRQ number is out of range or identifies a
+ * reserved entry.
+ *
+ * \tparam DEFAULT_HANDLER The handler for entries that are not bound.
+ * \tparam Bindings The bindings (picolibrary::Arm::Cortex::M0PLUS::Interrupt::Binding
+ *         specializations).
+ *
+ * \param[in] stack The initial stack pointer value.
+ *
+ * \return The interrupt vector table.
+ */
+template<Handler DEFAULT_HANDLER, typename... Bindings>
+constexpr auto make_vector_table( void * stack ) noexcept -> Vector_Table
+{
+    static_assert( ( ( Bindings::IRQ == RESET_IRQ ) or ... ), "the reset exception must be bound" );
+
+    static_assert( not Implementation::has_duplicate_binding<Bindings...>(), "exception bound more than once" );
+
+    static_assert(
+        ( ( Bindings::IRQ >= RESET_IRQ and Bindings::IRQ < static_cast<IRQ_Number>( VECTORS ) - 15 ) and ... ),
+        "IRQ number out of range" );
+
+    static_assert( ( not Implementation::is_reserved( Bindings::IRQ ) and ... ), "reserved entry bound" );
+
+    return Implementation::make_vector_table<DEFAULT_HANDLER, Bindings...>(
+        stack, std::make_index_sequence<VECTORS>{} );
+}
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS::Interrupt
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_VECTOR_TABLE_BUILDER_H
@@ -0,0 +1,288 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Work_Queue and
+ *        picolibrary::Arm::Cortex::M0PLUS::Deferred_Work_Queue interface.
+ */
+
+#ifndef PICOLIBRARY_ARM_CORTEX_M0PLUS_WORK_QUEUE_H
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_WORK_QUEUE_H
+
+#include <array>
+#include <cstddef>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+/**
+ * \brief Fixed capacity, interrupt safe work queue.
+ *
+ * Work items are queued and removed inside critical sections, so work can be queued from
+ * any context, including interrupt handlers. Work items are run in the order they were
+ * queued, with interrupts enabled.
+ *
+ * \tparam CAPACITY The maximum number of queued work items.
+ */
+template<std::size_t CAPACITY>
+class Work_Queue {
+  public:
+    static_assert( CAPACITY > 0, "CAPACITY must be non-zero" );
+
+    /**
+     * \brief Work function.
+     */
+    using Work = void ( * )( void * context );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Work_Queue() noexcept = default;
+
+    Work_Queue( Work_Queue && ) = delete;
+
+    Work_Queue( Work_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Work_Queue() noexcept = default;
+
+    auto operator=( Work_Queue && ) = delete;
+
+    auto operator=( Work_Queue const & ) = delete;
+
+    /**
+     * \brief Get the maximum number of queued work items.
+     *
+     * \return The maximum number of queued work items.
+     */
+    static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * \brief Check if the queue is empty.
+     *
+     * \return true if the queue is empty.
+     * \return false if the queue is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        return not m_size;
+    }
+
+    /**
+     * \brief Queue a work item.
+     *
+     * \param[in] work The work function.
+     * \param[in] context The context to pass to the work function.
+     *
+     * \return true if the work item was queued.
+     * \return false if the queue is full.
+     */
+    auto push( Work work, void * context ) noexcept -> bool
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        if ( m_size == CAPACITY ) {
+            return false;
+        } // if
+
+        m_items[ m_tail ] = Item{ work, context };
+
+        m_tail = next( m_tail );
+        ++m_size;
+
+        return true;
+    }
+
+    /**
+     * \brief Run queued work items until the queue is empty.
+     *
+     * Work items queued while the queue is being drained (including by the work items
+     * themselves) are also run.
+     */
+    void drain() noexcept
+    {
+        for ( ;; ) {
+            Item item;
+
+            {
+                Interrupt::Critical_Section_Guard const guard;
+
+                if ( not m_size ) {
+                    return;
+                } // if
+
+                item = m_items[ m_head ];
+
+                m_head = next( m_head );
+                --m_size;
+            }
+
+            item.work( item.context );
+        } // for
+    }
+
+  private:
+    /**
+     * \brief Work item.
+     */
+    struct Item {
+        /**
+         * \brief The work function.
+         */
+        Work work;
+
+        /**
+         * \brief The context to pass to the work function.
+         */
+        void * context;
+    };
+
+    /**
+     * \brief The work item storage.
+     */
+    std::array<Item, CAPACITY> m_items{};
+
+    /**
+     * \brief The index of the oldest queued work item.
+     */
+    std::size_t m_head{};
+
+    /**
+     * \brief The index at which the next work item will be queued.
+     */
+    std::size_t m_tail{};
+
+    /**
+     * \brief The number of queued work items.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief Get the index that follows a work item storage index.
+     *
+     * \param[in] index The work item storage index.
+     *
+     * \return The index that follows the work item storage index.
+     */
+    static constexpr auto next( std::size_t index ) noexcept -> std::size_t
+    {
+        return index + 1 == CAPACITY ? 0 : index + 1;
+    }
+};
+
+/**
+ * \brief Deferred work queue (interrupt handler bottom halves) drained by the PENDSV
+ *        interrupt handler.
+ *
+ * Queueing a work item pends the PENDSV exception, whose priority is set to the lowest
+ * priority, so queued work runs after all other interrupt handlers have returned, and
+ * never delays another interrupt.
+ *
+ * \tparam CAPACITY The maximum number of queued work items.
+ *
+ * \attention picolibrary::Arm::Cortex::M0PLUS::Deferred_Work_Queue::handle_interrupt()
+ *            must be called by the PENDSV interrupt handler.
+ */
+template<std::size_t CAPACITY>
+class Deferred_Work_Queue {
+  public:
+    /**
+     * \brief Work function.
+     */
+    using Work = typename Work_Queue<CAPACITY>::Work;
+
+    Deferred_Work_Queue() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * Sets the PENDSV exception's priority to the lowest priority.
+     *
+     * \param[in] scb The SCB peripheral instance to use.
+     */
+    explicit Deferred_Work_Queue( Peripheral::SCB & scb ) noexcept : m_scb{ &scb }
+    {
+        set_pendsv_priority( *m_scb, Interrupt_Priority::LOWEST );
+    }
+
+    Deferred_Work_Queue( Deferred_Work_Queue && ) = delete;
+
+    Deferred_Work_Queue( Deferred_Work_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Deferred_Work_Queue() noexcept = default;
+
+    auto operator=( Deferred_Work_Queue && ) = delete;
+
+    auto operator=( Deferred_Work_Queue const & ) = delete;
+
+    /**
+     * \brief Queue a work item and pend the PENDSV exception.
+     *
+     * \param[in] work The work function.
+     * \param[in] context The context to pass to the work function.
+     *
+     * \return true if the work item was queued.
+     * \return false if the queue is full.
+     */
+    auto defer( Work work, void * context ) noexcept -> bool
+    {
+        if ( not m_queue.push( work, context ) ) {
+            return false;
+        } // if
+
+        m_scb->icsr = Peripheral::SCB::ICSR::Mask::PENDSVSET;
+
+        return true;
+    }
+
+    /**
+     * \brief Handle a PENDSV interrupt (run queued work items until the queue is empty).
+     */
+    void handle_interrupt() noexcept
+    {
+        m_queue.drain();
+    }
+
+  private:
+    /**
+     * \brief The SCB peripheral instance.
+     */
+    Peripheral::SCB * m_scb;
+
+    /**
+     * \brief The work queue.
+     */
+    Work_Queue<CAPACITY> m_queue{};
+};
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_WORK_QUEUE_H
@@ -0,0 +1,374 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief Atomic operation library (libatomic) helper implementation.
+ *
+ * Arm Cortex-M0+ processors do not implement exclusive loads and stores, so GCC
+ * implements atomic read-modify-write operations (and 64-bit atomic loads and stores) by
+ * calling __atomic_* and __sync_* helper functions, which GCC does not provide for
+ * ARMv6-M. These helpers perform the operations with interrupts disabled (PRIMASK is
+ * saved with MRS and set with CPSID I before the operation, and restored with MSR after
+ * the operation).
+ *
+ * This file must not be compiled with link time optimization: calls to the helpers are
+ * generated after link time optimization, so the helpers would otherwise be discarded.
+ *
+ * The library calls GCC generates for __atomic_compare_exchange_N() do not pass the
+ * builtin's weak argument, which conflicts with the builtin's declaration, so those
+ * helpers are defined under different names and given the library names with asm
+ * labels.
+ *
+ * \attention The helpers are only atomic with respect to interrupts on the core that
+ *            executes them, they do not provide atomicity with respect to other cores or
+ *            bus masters.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+
+namespace {
+
+/**
+ * \brief Atomically load a value.
+ *
+ * \tparam T The value type.
+ *
+ * \param[in] pointer The address of the value.
+ *
+ * \return The value.
+ */
+template<typename T>
+auto load( void const volatile * pointer ) noexcept -> T
+{
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Critical_Section_Guard const guard;
+
+    return *static_cast<T const volatile *>( pointer );
+}
+
+/**
+ * \brief Atomically store a value.
+ *
+ * \tparam T The value type.
+ *
+ * \param[in] pointer The address of the value.
+ * \param[in] value The value to store.
+ */
+template<typename T>
+void store( void volatile * pointer, T value ) noexcept
+{
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Critical_Section_Guard const guard;
+
+    *static_cast<T volatile *>( pointer ) = value;
+}
+
+/**
+ * \brief Exchange operation.
+ */
+struct Exchange {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] value The operand.
+     *
+     * \return The operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T, T value ) noexcept -> T
+    {
+        return value;
+    }
+};
+
+/**
+ * \brief Addition operation.
+ */
+struct Add {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The sum of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( old + value );
+    }
+};
+
+/**
+ * \brief Subtraction operation.
+ */
+struct Sub {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The difference of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( old - value );
+    }
+};
+
+/**
+ * \brief Bitwise AND operation.
+ */
+struct And {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The bitwise AND of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( old & value );
+    }
+};
+
+/**
+ * \brief Bitwise OR operation.
+ */
+struct Or {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The bitwise OR of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( old | value );
+    }
+};
+
+/**
+ * \brief Bitwise XOR operation.
+ */
+struct Xor {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The bitwise XOR of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( old ^ value );
+    }
+};
+
+/**
+ * \brief Bitwise NAND operation.
+ */
+struct Nand {
+    /**
+     * \brief Compute the new value.
+     *
+     * \tparam T The value type.
+     *
+     * \param[in] old The old value.
+     * \param[in] value The operand.
+     *
+     * \return The bitwise NAND of the old value and the operand.
+     */
+    template<typename T>
+    static constexpr auto apply( T old, T value ) noexcept -> T
+    {
+        return static_cast<T>( ~( old & value ) );
+    }
+};
+
+/**
+ * \brief Atomically modify a value.
+ *
+ * \tparam T The value type.
+ * \tparam Operation The operation that computes the new value.
+ *
+ * \param[in] pointer The address of the value.
+ * \param[in] value The operand.
+ *
+ * \return The old value.
+ */
+template<typename T, typename Operation>
+auto fetch_modify( void volatile * pointer, T value ) noexcept -> T
+{
+    auto const object = static_cast<T volatile *>( pointer );
+
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Critical_Section_Guard const guard;
+
+    T const old = *object;
+
+    *object = Operation::apply( old, value );
+
+    return old;
+}
+
+/**
+ * \brief Atomically compare a value with an expected value, and replace it if they are
+ *        equal.
+ *
+ * \tparam T The value type.
+ *
+ * \param[in] pointer The address of the value.
+ * \param[in] expected The expected value.
+ * \param[in] desired The replacement value.
+ *
+ * \return The old value.
+ */
+template<typename T>
+auto compare_exchange( void volatile * pointer, T expected, T desired ) noexcept -> T
+{
+    auto const object = static_cast<T volatile *>( pointer );
+
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Critical_Section_Guard const guard;
+
+    T const old = *object;
+
+    if ( old == expected ) {
+        *object = desired;
+    } // if
+
+    return old;
+}
+
+} // namespace
+
+// clang-format off
+
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, NAME, OPERATION )                    \
+    [[gnu::used]] T __atomic_fetch_##NAME##_##N( void volatile * pointer, T value, int ) noexcept       \
+    {                                                                                                   \
+        return fetch_modify<T, OPERATION>( pointer, value );                                            \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __atomic_##NAME##_fetch_##N( void volatile * pointer, T value, int ) noexcept       \
+    {                                                                                                   \
+        return OPERATION::apply( fetch_modify<T, OPERATION>( pointer, value ), value );                 \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __sync_fetch_and_##NAME##_##N( void volatile * pointer, T value ) noexcept          \
+    {                                                                                                   \
+        return fetch_modify<T, OPERATION>( pointer, value );                                            \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __sync_##NAME##_and_fetch_##N( void volatile * pointer, T value ) noexcept          \
+    {                                                                                                   \
+        return OPERATION::apply( fetch_modify<T, OPERATION>( pointer, value ), value );                 \
+    }
+
+#define PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC( N, T )                                                     \
+    [[gnu::used]] T __atomic_load_##N( void const volatile * pointer, int ) noexcept                    \
+    {                                                                                                   \
+        return load<T>( pointer );                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] void __atomic_store_##N( void volatile * pointer, T value, int ) noexcept             \
+    {                                                                                                   \
+        store<T>( pointer, value );                                                                     \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __atomic_exchange_##N( void volatile * pointer, T value, int ) noexcept             \
+    {                                                                                                   \
+        return fetch_modify<T, Exchange>( pointer, value );                                             \
+    }                                                                                                   \
+                                                                                                        \
+    bool picolibrary_arm_cortex_m0plus_atomic_compare_exchange_##N(                                     \
+        void volatile * pointer, void * expected, T desired, int, int ) noexcept                        \
+        __asm__( "__atomic_compare_exchange_" #N );                                                     \
+                                                                                                        \
+    [[gnu::used]] bool picolibrary_arm_cortex_m0plus_atomic_compare_exchange_##N(                       \
+        void volatile * pointer, void * expected, T desired, int, int ) noexcept                        \
+    {                                                                                                   \
+        auto const expected_value = static_cast<T *>( expected );                                        \
+        auto const old            = compare_exchange<T>( pointer, *expected_value, desired );            \
+                                                                                                        \
+        if ( old == *expected_value ) {                                                                 \
+            return true;                                                                                \
+        }                                                                                               \
+                                                                                                        \
+        *expected_value = old;                                                                          \
+                                                                                                        \
+        return false;                                                                                   \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __sync_lock_test_and_set_##N( void volatile * pointer, T value ) noexcept           \
+    {                                                                                                   \
+        return fetch_modify<T, Exchange>( pointer, value );                                             \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] T __sync_val_compare_and_swap_##N( void volatile * pointer, T expected, T desired ) noexcept \
+    {                                                                                                   \
+        return compare_exchange<T>( pointer, expected, desired );                                       \
+    }                                                                                                   \
+                                                                                                        \
+    [[gnu::used]] bool __sync_bool_compare_and_swap_##N( void volatile * pointer, T expected, T desired ) noexcept \
+    {                                                                                                   \
+        return compare_exchange<T>( pointer, expected, desired ) == expected;                           \
+    }                                                                                                   \
+                                                                                                        \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, add, Add )                              \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, sub, Sub )                              \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, and, And )                              \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, or, Or )                                \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, xor, Xor )                              \
+    PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION( N, T, nand, Nand )
+
+// clang-format on
+
+extern "C" {
+
+PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC( 1, std::uint8_t )
+PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC( 2, std::uint16_t )
+PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC( 4, std::uint32_t )
+PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC( 8, std::uint64_t )
+
+} // extern "C"
+
+#undef PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC
+#undef PICOLIBRARY_ARM_CORTEX_M0PLUS_ATOMIC_FETCH_OPERATION
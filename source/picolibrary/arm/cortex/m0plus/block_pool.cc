@@ -0,0 +1,82 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Block_Pool implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/block_pool.h"
+
+#include <cstddef>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+Block_Pool::Block_Pool( void * storage, std::size_t block_size, std::size_t blocks ) noexcept :
+    m_block_size{ block_size },
+    m_blocks{ blocks }
+{
+    auto const pool = static_cast<unsigned char *>( storage );
+
+    for ( auto block = blocks; block--; ) {
+        auto const free_block = static_cast<Free_Block *>( static_cast<void *>( pool + block * block_size ) );
+
+        free_block->next = m_free;
+
+        m_free = free_block;
+    } // for
+}
+
+auto Block_Pool::allocate() noexcept -> void *
+{
+    Interrupt::Critical_Section_Guard const guard;
+
+    auto const block = m_free;
+
+    if ( not block ) {
+        return nullptr;
+    } // if
+
+    m_free = block->next;
+
+    auto const allocated = m_allocated + 1;
+
+    m_allocated = allocated;
+
+    if ( allocated > m_high_water_mark ) {
+        m_high_water_mark = allocated;
+    } // if
+
+    return block;
+}
+
+void Block_Pool::deallocate( void * block ) noexcept
+{
+    auto const free_block = static_cast<Free_Block *>( block );
+
+    Interrupt::Critical_Section_Guard const guard;
+
+    free_block->next = m_free;
+
+    m_free = free_block;
+
+    m_allocated = m_allocated - 1;
+}
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
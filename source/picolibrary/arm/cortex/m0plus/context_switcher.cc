@@ -0,0 +1,210 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Thread and
+ *        picolibrary::Arm::Cortex::M0PLUS::Context_Switcher implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/context_switcher.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+
+extern "C" {
+
+/**
+ * \brief The running thread (accessed by the context switch handlers).
+ */
+::picolibrary::Arm::Cortex::M0PLUS::Thread * picolibrary_arm_cortex_m0plus_current_thread = nullptr;
+
+/**
+ * \brief The thread to switch to (accessed by the context switch handlers).
+ */
+::picolibrary::Arm::Cortex::M0PLUS::Thread * picolibrary_arm_cortex_m0plus_next_thread = nullptr;
+
+} // extern "C"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+namespace {
+
+/**
+ * \brief Function called if a thread's entry function returns.
+ */
+[[noreturn]] void exit_thread() noexcept
+{
+    for ( ;; ) {
+        wait_for_interrupt();
+    } // for
+}
+
+/**
+ * \brief Initial xPSR value (Thumb state).
+ */
+constexpr auto XPSR = std::uint32_t{ 1 } << 24;
+
+} // namespace
+
+Thread::Thread( void * stack, std::size_t stack_size, Entry entry, void * context ) noexcept
+{
+    // the initial context (lowest address first) is R4-R7, R8-R11, and the exception
+    // frame (R0-R3, R12, LR, PC, and xPSR), with the exception frame 8 byte aligned
+    auto const top = ( reinterpret_cast<std::uintptr_t>( stack ) + stack_size ) & ~std::uintptr_t{ 7 };
+
+    auto const frame = reinterpret_cast<std::uint32_t *>( top - 16 * 4 );
+
+    for ( auto word = std::size_t{}; word < 8; ++word ) {
+        frame[ word ] = 0;
+    } // for
+
+    frame[ 8 ]  = static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( context ) );
+    frame[ 9 ]  = 0;
+    frame[ 10 ] = 0;
+    frame[ 11 ] = 0;
+    frame[ 12 ] = 0;
+    frame[ 13 ] = static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( &exit_thread ) );
+    frame[ 14 ] = static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( entry ) ) & ~std::uint32_t{ 1 };
+    frame[ 15 ] = XPSR;
+
+    m_stack_pointer = frame;
+}
+
+void Context_Switcher::start( Peripheral::SCB & scb, Thread & thread ) noexcept
+{
+    set_pendsv_priority( scb, Interrupt_Priority::LOWEST );
+
+    picolibrary_arm_cortex_m0plus_current_thread = &thread;
+    picolibrary_arm_cortex_m0plus_next_thread    = &thread;
+
+    data_synchronization_barrier();
+
+    supervisor_call();
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // threads are never run on the host
+    exit_thread();
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // the SVCALL interrupt handler returns to the thread instead of this function
+    __builtin_unreachable();
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+}
+
+void Context_Switcher::switch_to( Peripheral::SCB & scb, Thread & thread ) noexcept
+{
+    // the PENDSV interrupt handler saves the running thread's context through the current
+    // thread pointer, so there must be a running thread to switch from
+    if ( not picolibrary_arm_cortex_m0plus_current_thread ) {
+        return;
+    } // if
+
+    picolibrary_arm_cortex_m0plus_next_thread = &thread;
+
+    scb.icsr = Peripheral::SCB::ICSR::Mask::PENDSVSET;
+}
+
+auto Context_Switcher::current_thread() noexcept -> Thread *
+{
+    return picolibrary_arm_cortex_m0plus_current_thread;
+}
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+void Context_Switcher::pendsv_handler() noexcept
+{
+    // there are no thread stacks to switch on the host
+    picolibrary_arm_cortex_m0plus_current_thread = picolibrary_arm_cortex_m0plus_next_thread;
+}
+
+void Context_Switcher::svcall_handler() noexcept
+{
+}
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+[[gnu::naked]] void Context_Switcher::pendsv_handler() noexcept
+{
+    // R0-R3, R12, LR, PC, and xPSR were saved on the running thread's stack on exception
+    // entry, and LR holds the EXC_RETURN value for returning to thread mode using the PSP
+    asm volatile(
+        ".syntax unified                                           \n\t"
+
+        // save R4-R11 below the exception frame
+        "mrs   r0, psp                                             \n\t"
+        "subs  r0, #32                                             \n\t"
+        "stmia r0!, {r4-r7}                                        \n\t"
+        "mov   r4, r8                                              \n\t"
+        "mov   r5, r9                                              \n\t"
+        "mov   r6, r10                                             \n\t"
+        "mov   r7, r11                                             \n\t"
+        "stmia r0!, {r4-r7}                                        \n\t"
+        "subs  r0, #32                                             \n\t"
+
+        // save the running thread's stack pointer, and make the next thread the running
+        // thread
+        "ldr   r2, =picolibrary_arm_cortex_m0plus_current_thread   \n\t"
+        "ldr   r1, [r2]                                            \n\t"
+        "str   r0, [r1]                                            \n\t"
+        "ldr   r3, =picolibrary_arm_cortex_m0plus_next_thread      \n\t"
+        "ldr   r1, [r3]                                            \n\t"
+        "str   r1, [r2]                                            \n\t"
+        "ldr   r0, [r1]                                            \n\t"
+
+        // restore R8-R11, point the PSP at the exception frame, and restore R4-R7
+        "adds  r0, #16                                             \n\t"
+        "ldmia r0!, {r4-r7}                                        \n\t"
+        "mov   r8, r4                                              \n\t"
+        "mov   r9, r5                                              \n\t"
+        "mov   r10, r6                                             \n\t"
+        "mov   r11, r7                                             \n\t"
+        "msr   psp, r0                                             \n\t"
+        "subs  r0, #32                                             \n\t"
+        "ldmia r0!, {r4-r7}                                        \n\t"
+        "bx    lr                                                  \n\t"
+        ".ltorg                                                    \n\t" );
+}
+
+[[gnu::naked]] void Context_Switcher::svcall_handler() noexcept
+{
+    asm volatile(
+        ".syntax unified                                           \n\t"
+
+        // restore R8-R11, point the PSP at the exception frame, and restore R4-R7
+        "ldr   r3, =picolibrary_arm_cortex_m0plus_current_thread   \n\t"
+        "ldr   r1, [r3]                                            \n\t"
+        "ldr   r0, [r1]                                            \n\t"
+        "adds  r0, #16                                             \n\t"
+        "ldmia r0!, {r4-r7}                                        \n\t"
+        "mov   r8, r4                                              \n\t"
+        "mov   r9, r5                                              \n\t"
+        "mov   r10, r6                                             \n\t"
+        "mov   r11, r7                                             \n\t"
+        "msr   psp, r0                                             \n\t"
+        "subs  r0, #32                                             \n\t"
+        "ldmia r0!, {r4-r7}                                        \n\t"
+
+        // return to thread mode using the PSP (EXC_RETURN 0xFFFFFFFD)
+        "movs  r0, #2                                              \n\t"
+        "mvns  r0, r0                                              \n\t"
+        "bx    r0                                                  \n\t"
+        ".ltorg                                                    \n\t" );
+}
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
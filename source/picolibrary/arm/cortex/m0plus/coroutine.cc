@@ -0,0 +1,138 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Coroutine_Executor implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/coroutine.h"
+
+#if defined( __cpp_impl_coroutine )
+
+#include <cstddef>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt_controller.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+Coroutine_Executor::Coroutine_Executor( void * frame_pool, std::size_t block_size, std::size_t blocks ) noexcept :
+    m_frame_pool{ frame_pool, block_size, blocks }
+{
+}
+
+Coroutine_Executor::Coroutine_Executor( Peripheral::SCB & scb, void * frame_pool, std::size_t block_size, std::size_t blocks ) noexcept :
+    Coroutine_Executor{ frame_pool, block_size, blocks }
+{
+    m_scb = &scb;
+
+    set_pendsv_priority( *m_scb, Interrupt_Priority::LOWEST );
+}
+
+auto Coroutine_Executor::spawn( Coroutine && coroutine ) noexcept -> bool
+{
+    if ( not coroutine.m_handle ) {
+        return false;
+    } // if
+
+    auto & promise = coroutine.m_handle.promise();
+
+    coroutine.m_handle = {};
+
+    schedule( promise );
+
+    return true;
+}
+
+void Coroutine_Executor::schedule( Coroutine_Promise & promise ) noexcept
+{
+    {
+        Interrupt::Critical_Section_Guard const guard;
+
+        promise.m_next = nullptr;
+
+        if ( m_tail ) {
+            m_tail->m_next = &promise;
+        } else {
+            m_head = &promise;
+        } // else
+
+        m_tail = &promise;
+    }
+
+    if ( m_scb ) {
+        m_scb->icsr = Peripheral::SCB::ICSR::Mask::PENDSVSET;
+    } // if
+}
+
+void Coroutine_Executor::run() noexcept
+{
+    for ( ;; ) {
+        Coroutine_Promise * promise;
+
+        {
+            Interrupt::Critical_Section_Guard const guard;
+
+            promise = m_head;
+
+            if ( not promise ) {
+                return;
+            } // if
+
+            m_head = promise->m_next;
+
+            if ( not m_head ) {
+                m_tail = nullptr;
+            } // if
+        }
+
+        std::coroutine_handle<Coroutine_Promise>::from_promise( *promise ).resume();
+    } // for
+}
+
+auto Coroutine_Executor::allocate( std::size_t size ) noexcept -> void *
+{
+    if ( size + FRAME_HEADER_SIZE > m_frame_pool.block_size() ) {
+        return nullptr;
+    } // if
+
+    auto const block = m_frame_pool.allocate();
+
+    if ( not block ) {
+        return nullptr;
+    } // if
+
+    // the header identifies the executor whose frame pool the frame was allocated from
+    *static_cast<Coroutine_Executor **>( block ) = this;
+
+    return static_cast<unsigned char *>( block ) + FRAME_HEADER_SIZE;
+}
+
+void Coroutine_Executor::deallocate( void * frame ) noexcept
+{
+    auto const block = static_cast<unsigned char *>( frame ) - FRAME_HEADER_SIZE;
+
+    auto const executor = *static_cast<Coroutine_Executor **>( static_cast<void *>( block ) );
+
+    executor->m_frame_pool.deallocate( block );
+}
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
+
+#endif // defined( __cpp_impl_coroutine )
@@ -0,0 +1,62 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Cycle_Loop_Delayer implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/cycle_loop_delayer.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+void Cycle_Loop_Delayer::calibrate( Peripheral::SYSTICK const & systick ) noexcept
+{
+    // take the shortest of several measurements to reject measurements that were
+    // extended by interrupts
+    auto cycles = ~std::uint32_t{};
+    for ( auto measurement = 0; measurement < 4; ++measurement ) {
+        auto const start = static_cast<std::uint32_t>( systick.cvr );
+        loop( CALIBRATION_ITERATIONS );
+        auto const end = static_cast<std::uint32_t>( systick.cvr );
+
+        // the counter counts down, and is reloaded from RVR after reaching 0
+        auto const elapsed = end <= start ? start - end : start + ( systick.rvr + 1 ) - end;
+
+        if ( elapsed < cycles ) {
+            cycles = elapsed;
+        } // if
+    }     // for
+
+    // the loop cannot run faster than nominal, a shorter measurement is treated as
+    // nominal so that the scale factor never exceeds unity
+    if ( cycles <= CALIBRATION_ITERATIONS * CYCLES_PER_ITERATION ) {
+        m_scale = UNITY_SCALE;
+        return;
+    } // if
+
+    m_scale = ( ( CALIBRATION_ITERATIONS * CYCLES_PER_ITERATION ) << SCALE_FRACTION_BITS ) / cycles;
+}
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
@@ -0,0 +1,173 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::SYSTICK_Calibration implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/systick_calibration.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/arm/cortex/m0plus/systick_clock_source.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+namespace {
+
+/**
+ * \brief SYSTICK peripheral counter configuration candidate.
+ */
+struct Candidate {
+    /**
+     * \brief The SYSTICK peripheral counter configuration.
+     */
+    SYSTICK_Counter_Configuration configuration;
+
+    /**
+     * \brief The SYSTICK peripheral clock source's frequency (Hz).
+     */
+    std::uint64_t frequency;
+
+    /**
+     * \brief The rounding error (SYSTICK peripheral counter clock cycles).
+     */
+    std::uint64_t error;
+};
+
+/**
+ * \brief Compute a SYSTICK peripheral counter configuration candidate.
+ *
+ * The candidate is computed the same way picolibrary::Arm::Cortex::M0PLUS::Delay_Configuration
+ * computes a configuration at compile time.
+ *
+ * \param[in] clock_source The SYSTICK peripheral clock source.
+ * \param[in] frequency The SYSTICK peripheral clock source's frequency (Hz).
+ * \param[in] count The duration's tick count.
+ * \param[in] numerator The duration's tick period's numerator.
+ * \param[in] denominator The duration's tick period's denominator.
+ *
+ * \return The SYSTICK peripheral counter configuration candidate (the configuration's
+ *         tick count is 0 if the duration cannot be created).
+ */
+auto candidate(
+    SYSTICK_Clock_Source clock_source,
+    std::uint32_t        frequency,
+    std::uint64_t        count,
+    std::uint64_t        numerator,
+    std::uint64_t        denominator ) noexcept -> Candidate
+{
+    auto result = Candidate{ { clock_source, 0, 0 }, frequency, 0 };
+
+    if ( not frequency ) {
+        return result;
+    } // if
+
+    auto const cycles = ( std::uint64_t{ frequency } * count * numerator + denominator / 2 ) / denominator;
+
+    if ( not cycles ) {
+        return result;
+    } // if
+
+    auto const period_max = std::uint64_t{ Peripheral::SYSTICK::RVR::Mask::RELOAD } + 1;
+
+    auto const ticks_min = ( cycles + period_max - 1 ) / period_max;
+
+    auto ticks = ticks_min;
+    for ( auto candidate_ticks = ticks_min;
+          candidate_ticks < ticks_min + 256 and candidate_ticks <= cycles;
+          ++candidate_ticks ) {
+        if ( cycles % candidate_ticks == 0 ) {
+            ticks = candidate_ticks;
+            break;
+        } // if
+    }     // for
+
+    if ( ticks > std::numeric_limits<std::uint32_t>::max() ) {
+        return result;
+    } // if
+
+    auto const period = ( cycles + ticks / 2 ) / ticks;
+
+    if ( period < 2 ) {
+        return result;
+    } // if
+
+    result.configuration.reload_value = static_cast<std::uint32_t>( period - 1 );
+    result.configuration.ticks        = static_cast<std::uint32_t>( ticks );
+
+    result.error = period * ticks > cycles ? period * ticks - cycles : cycles - period * ticks;
+
+    return result;
+}
+
+/**
+ * \brief Check if a SYSTICK peripheral counter configuration candidate is better than
+ *        another SYSTICK peripheral counter configuration candidate.
+ *
+ * \param[in] lhs The candidate to compare.
+ * \param[in] rhs The candidate to compare against.
+ *
+ * \return true if lhs is better than rhs.
+ * \return false if lhs is not better than rhs.
+ */
+auto is_better( Candidate const & lhs, Candidate const & rhs ) noexcept -> bool
+{
+    if ( not lhs.configuration.ticks ) {
+        return false;
+    } // if
+
+    if ( not rhs.configuration.ticks ) {
+        return true;
+    } // if
+
+    // compare the rounding errors in seconds without dividing
+    auto const lhs_error = lhs.error * rhs.frequency;
+    auto const rhs_error = rhs.error * lhs.frequency;
+
+    if ( lhs_error != rhs_error ) {
+        return lhs_error < rhs_error;
+    } // if
+
+    return lhs.configuration.ticks < rhs.configuration.ticks;
+}
+
+} // namespace
+
+auto SYSTICK_Calibration::configure(
+    std::uint32_t processor_clock_frequency,
+    std::uint64_t count,
+    std::uint64_t numerator,
+    std::uint64_t denominator ) const noexcept -> SYSTICK_Counter_Configuration
+{
+    auto const processor_clock = candidate(
+        Clock_Source::PROCESSOR_CLOCK,
+        this->processor_clock_frequency( processor_clock_frequency ),
+        count,
+        numerator,
+        denominator );
+    auto const reference_clock = candidate(
+        Clock_Source::EXTERNAL_REFERENCE_CLOCK, reference_clock_frequency(), count, numerator, denominator );
+
+    return is_better( reference_clock, processor_clock ) ? reference_clock.configuration
+                                                         : processor_clock.configuration;
+}
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS
@@ -0,0 +1,189 @@
+/**
+ * picolibrary-arm-cortex-m0plus
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-arm-cortex-m0plus contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arm::Cortex::M0PLUS::Uptime_Clock implementation.
+ */
+
+#include "picolibrary/arm/cortex/m0plus/uptime_clock.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/configuration.h"
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/arm/cortex/m0plus/intrinsics.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/scb.h"
+#include "picolibrary/arm/cortex/m0plus/peripheral/systick.h"
+#include "picolibrary/utility.h"
+
+namespace picolibrary::Arm::Cortex::M0PLUS {
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+void Uptime_Clock::restart_period( Ticks end ) noexcept
+{
+    handle_pending_interrupt();
+
+    // the new period ends ( end - restart ) counter clock cycles after the restart, where
+    // restart = period_start() + m_period - current + m_restart_latency, so the reload
+    // value is computed from the counter value in a fixed length instruction sequence
+    auto const reload_offset = static_cast<std::uint32_t>(
+        end - period_start() - m_period - m_restart_latency - 1 );
+
+    std::uint32_t current;
+    std::uint32_t reload_value;
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    current      = m_systick->cvr;
+    reload_value = reload_offset + current;
+
+    m_systick->rvr = reload_value;
+    m_systick->cvr = reload_value;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    asm volatile(
+        ".syntax unified                                    \n\t"
+        "ldr  %[current], [%[cvr]]                          \n\t"
+        "adds %[reload_value], %[reload_offset], %[current] \n\t"
+        "str  %[reload_value], [%[rvr]]                     \n\t"
+        "str  %[reload_value], [%[cvr]]                     \n\t"
+        : [current] "=&l"( current ), [reload_value] "=&l"( reload_value )
+        : [cvr] "l"( &m_systick->cvr ), [rvr] "l"( &m_systick->rvr ), [reload_offset] "l"( reload_offset )
+        : "cc", "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+
+    // a counter period that ended between the counter read and the counter write is
+    // accounted for by the counter value that was read (a counter value of 0 marks the
+    // end of the current period)
+    m_scb->icsr = Peripheral::SCB::ICSR::Mask::PENDSTCLR;
+
+    auto const elapsed = end - ( reload_value + 1 );
+
+    m_elapsed_low  = static_cast<std::uint32_t>( elapsed );
+    m_elapsed_high = static_cast<std::uint32_t>( elapsed >> 32 );
+
+    m_period = reload_value + 1;
+
+    // the reload value is loaded one counter clock cycle after the counter is written,
+    // after which the reload value for the following periods can be restored
+    while ( not m_systick->cvr ) {} // while
+
+    m_systick->rvr = m_next_period - 1;
+}
+
+void Uptime_Clock::reconfigure( Clock_Source clock_source, std::uint32_t reload_value ) noexcept
+{
+    auto const csr = to_underlying( clock_source ) | Peripheral::SYSTICK::CSR::Mask::TICKINT
+                     | Peripheral::SYSTICK::CSR::Mask::ENABLE;
+
+    Interrupt::Critical_Section_Guard const guard;
+
+    // the counter must not reach 0 between the pending interrupt check and the counter
+    // read (see WRAP_MARGIN), so only the one-off period check is done in between
+    handle_pending_interrupt();
+
+    auto const one_off_period = m_period != m_next_period;
+
+    std::uint32_t current;
+
+#if PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    current = m_systick->cvr;
+
+    m_systick->rvr = reload_value;
+    m_systick->cvr = reload_value;
+    m_systick->csr = csr;
+#else  // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+    // read the counter, then restart it with the new reload value and clock source in a
+    // fixed length instruction sequence (CSR, RVR, and CVR are at offsets 0, 4, and 8)
+    asm volatile(
+        ".syntax unified                          \n\t"
+        "ldr %[current], [%[systick], #8]         \n\t"
+        "str %[reload_value], [%[systick], #4]    \n\t"
+        "str %[reload_value], [%[systick], #8]    \n\t"
+        "str %[csr], [%[systick]]                 \n\t"
+        : [current] "=&l"( current )
+        : [systick] "l"( m_systick ), [reload_value] "l"( reload_value ), [csr] "l"( csr )
+        : "memory" );
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_INTRINSICS_EMULATED
+
+    // a counter period that ended between the counter read and the counter write is
+    // accounted for by the counter value that was read (a counter value of 0 marks the
+    // end of the current period)
+    m_scb->icsr = Peripheral::SCB::ICSR::Mask::PENDSTCLR;
+
+    auto const elapsed = period_start() + ( m_period - current )
+                         + ( m_restart_latency ? RECONFIGURE_LATENCY : 0 );
+
+    m_elapsed_low  = static_cast<std::uint32_t>( elapsed );
+    m_elapsed_high = static_cast<std::uint32_t>( elapsed >> 32 );
+
+    m_period = reload_value + 1;
+
+    m_restart_latency = ( m_systick->csr & Peripheral::SYSTICK::CSR::Mask::CLKSOURCE )
+                            ? RESTART_LATENCY
+                            : 0;
+
+    if ( one_off_period ) {
+        // the reload value is loaded one counter clock cycle after the counter is
+        // written, after which the reload value for the following periods can be restored
+        while ( not m_systick->cvr ) {} // while
+
+        m_systick->rvr = m_next_period - 1;
+    } else {
+        m_next_period = reload_value + 1;
+    } // else
+}
+
+void Uptime_Clock::reconfigure( Clock_Source clock_source, std::uint32_t reload_value, std::uint32_t frequency ) noexcept
+{
+    Interrupt::Critical_Section_Guard const guard;
+
+    reconfigure( clock_source, reload_value );
+
+    m_epoch = Epoch{ period_start(), frequency };
+}
+
+auto Uptime_Clock::epoch() const noexcept -> Epoch
+{
+    Interrupt::Critical_Section_Guard const guard;
+
+    return m_epoch;
+}
+
+void Uptime_Clock::handle_pending_interrupt() noexcept
+{
+    // account for counter periods that ended before the counter is restarted, and make
+    // sure the counter is far enough from the end of the current period that it cannot
+    // reach 0 before it is read, so that a counter value of 0 always marks the end of
+    // the current period and a period cannot end unaccounted for (periods that are too
+    // short for the margin only wait for the counter to leave 0)
+    for ( ;; ) {
+        if ( is_interrupt_pending() ) {
+            m_scb->icsr = Peripheral::SCB::ICSR::Mask::PENDSTCLR;
+
+            handle_interrupt();
+        } // if
+
+        auto const margin = m_period > 2 * WRAP_MARGIN ? WRAP_MARGIN : 0;
+
+        if ( m_systick->cvr > margin ) {
+            break;
+        } // if
+    }     // for
+}
+#endif // PICOLIBRARY_ARM_CORTEX_M0PLUS_IMPLEMENTATION_HAS_SYSTICK
+
+} // namespace picolibrary::Arm::Cortex::M0PLUS